@@ -6,6 +6,7 @@
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
 #include <ion/backlight.h>
+#include <ion/telemetry.h>
 #include <poincare/preferences.h>
 
 #include <algorithm>
@@ -361,6 +362,9 @@ void AppsContainer::run() {
     (void) switched; // Silence compilation warning about unused variable.
   } else {
     // Exception
+#if EPSILON_TELEMETRY
+    Ion::Telemetry::reportEvent("Exception", "PoolMemoryFull", "");
+#endif
     if (s_activeApp != nullptr) {
       /* The app models can reference layouts or expressions that have been
        * destroyed from the pool. To avoid using them before packing the app
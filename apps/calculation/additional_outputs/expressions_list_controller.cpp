@@ -72,6 +72,7 @@ void ExpressionsListController::setExpression(Poincare::Expression e) {
   for (int i = 0; i < k_maxNumberOfRows; i++) {
     m_layouts[i] = Layout();
   }
+  resetMemoizedHeights();
   m_expression = e;
 }
 
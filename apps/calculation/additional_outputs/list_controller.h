@@ -8,7 +8,7 @@ namespace Calculation {
 
 class EditExpressionController;
 
-class ListController : public StackViewController, public ListViewDataSource, public SelectableTableViewDataSource {
+class ListController : public StackViewController, public MemoizedListViewDataSource, public SelectableTableViewDataSource {
 public:
   ListController(EditExpressionController * editExpressionController, SelectableTableViewDelegate * delegate = nullptr);
 
@@ -19,7 +19,8 @@ HistoryController::HistoryController(EditExpressionController * editExpressionCo
   m_secondDegreeController(editExpressionController),
   m_trigonometryController(editExpressionController),
   m_unitController(editExpressionController),
-  m_matrixController(editExpressionController)
+  m_matrixController(editExpressionController),
+  m_memoizedExpandedRow(-1)
 {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].setParentResponder(&m_selectableTableView);
@@ -211,14 +212,44 @@ KDCoordinate HistoryController::rowHeight(int j) {
     return 0;
   }
   Shared::ExpiringPointer<Calculation> calculation = calculationAtIndex(j);
-  bool expanded = j == selectedRow() && selectedSubviewType() == SubviewType::Output;
-  return calculation->height(expanded);
+  return calculation->height(j == expandedRow());
+}
+
+KDCoordinate HistoryController::cumulatedHeightFromIndex(int j) {
+  updateMemoizedExpandedRow();
+  return MemoizedListViewDataSource::cumulatedHeightFromIndex(j);
+}
+
+int HistoryController::indexFromCumulatedHeight(KDCoordinate offsetY) {
+  updateMemoizedExpandedRow();
+  return MemoizedListViewDataSource::indexFromCumulatedHeight(offsetY);
+}
+
+void HistoryController::resetMemoizedHeights() {
+  MemoizedListViewDataSource::resetMemoizedHeights();
+  m_memoizedExpandedRow = expandedRow();
 }
 
 int HistoryController::typeAtLocation(int i, int j) {
   return 0;
 }
 
+int HistoryController::expandedRow() {
+  return selectedSubviewType() == SubviewType::Output ? selectedRow() : -1;
+}
+
+void HistoryController::updateMemoizedExpandedRow() {
+  /* Only the selected row might be expanded: when the selection changes, the
+   * heights of the previously and newly expanded rows are updated. */
+  int row = expandedRow();
+  if (row != m_memoizedExpandedRow) {
+    int previousRow = m_memoizedExpandedRow;
+    m_memoizedExpandedRow = row;
+    memoizedRowHeightDidChange(previousRow);
+    memoizedRowHeightDidChange(row);
+  }
+}
+
 bool HistoryController::calculationAtIndexToggles(int index) {
   Context * context = App::app()->localContext();
   return index >= 0 && index < m_calculationStore->numberOfCalculations() && calculationAtIndex(index)->displayOutput(context) == Calculation::DisplayOutput::ExactAndApproximateToggle;
@@ -17,11 +17,12 @@ namespace Calculation {
 
 class App;
 
-class HistoryController : public ViewController, public ListViewDataSource, public SelectableTableViewDataSource, public SelectableTableViewDelegate, public HistoryViewCellDataSource {
+class HistoryController : public ViewController, public MemoizedListViewDataSource, public SelectableTableViewDataSource, public SelectableTableViewDelegate, public HistoryViewCellDataSource {
 public:
   HistoryController(EditExpressionController * editExpressionController, CalculationStore * calculationStore);
   View * view() override { return &m_selectableTableView; }
   bool handleEvent(Ion::Events::Event event) override;
+  bool allowsEventCoalescing() const override { return true; }
   void viewWillAppear() override;
   TELEMETRY_ID("");
   void didBecomeFirstResponder() override;
@@ -32,6 +33,9 @@ public:
   int reusableCellCount(int type) override;
   void willDisplayCellForIndex(HighlightCell * cell, int index) override;
   KDCoordinate rowHeight(int j) override;
+  KDCoordinate cumulatedHeightFromIndex(int j) override;
+  int indexFromCumulatedHeight(KDCoordinate offsetY) override;
+  void resetMemoizedHeights() override;
   int typeAtLocation(int i, int j) override;
   void setSelectedSubviewType(SubviewType subviewType, bool sameCell, int previousSelectedX = -1, int previousSelectedY = -1) override;
   void tableViewDidChangeSelectionAndDidScroll(SelectableTableView * t, int previousSelectedCellX, int previousSelectedCellY, bool withinTemporarySelection = false) override;
@@ -41,6 +45,8 @@ private:
   Shared::ExpiringPointer<Calculation> calculationAtIndex(int i);
   CalculationSelectableTableView * selectableTableView();
   bool calculationAtIndexToggles(int index);
+  int expandedRow();
+  void updateMemoizedExpandedRow();
   void historyViewCellDidChangeSelection(HistoryViewCell ** cell, HistoryViewCell ** previousCell, int previousSelectedCellX, int previousSelectedCellY, SubviewType type, SubviewType previousType) override;
   constexpr static int k_maxNumberOfDisplayedRows = 8;
   CalculationSelectableTableView m_selectableTableView;
@@ -53,6 +59,7 @@ private:
   TrigonometryListController m_trigonometryController;
   UnitListController m_unitController;
   MatrixListController m_matrixController;
+  int m_memoizedExpandedRow;
 };
 
 }
@@ -238,7 +238,9 @@ const ToolboxMessageTree NumpyFunctionsModuleChildren[] = {
 const ToolboxMessageTree NumpyFftModuleChildren[] = {
   ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyFftFunction, I18n::Message::PythonNumpyFftFunction, false, I18n::Message::PythonCommandNumpyFftFunctionWithoutArg),
   ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyFft),
-  ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyIfft)
+  ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyIfft),
+  ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyRfft),
+  ToolboxMessageTree::Leaf(I18n::Message::PythonCommandNumpyIrfft)
 };
 
 const ToolboxMessageTree NumpyLinalgModuleChildren[] = {
@@ -14,7 +14,8 @@ CalculationGraphController::CalculationGraphController(Responder * parentRespond
   m_graphRange(curveViewRange),
   m_record(),
   m_defaultBannerView(BannerView::Font(), defaultMessage, 0.5f, 0.5f, BannerView::TextColor(), BannerView::BackgroundColor()),
-  m_isActive(false)
+  m_isActive(false),
+  m_scanTimer(this)
 {
 }
 
@@ -33,11 +34,17 @@ void CalculationGraphController::viewWillAppear() {
     m_graphRange->panToMakePointVisible(m_cursor->x(), m_cursor->y(), cursorTopMarginRatio(), cursorRightMarginRatio(), cursorBottomMarginRatio(), cursorLeftMarginRatio(), curveView()->pixelWidth());
     m_bannerView->setNumberOfSubviews(Shared::XYBannerView::k_numberOfSubviews);
     reloadBannerView();
+    m_scanTimer.start();
   }
   m_graphView->setOkView(nullptr);
   m_graphView->reload();
 }
 
+void CalculationGraphController::viewDidDisappear() {
+  m_scanTimer.stop();
+  Shared::SimpleInteractiveCurveViewController::viewDidDisappear();
+}
+
 void CalculationGraphController::setRecord(Ion::Storage::Record record) {
   m_graphView->selectRecord(record);
   m_record = record;
@@ -48,10 +55,38 @@ void CalculationGraphController::reloadBannerView() {
 }
 
 Coordinate2D<double> CalculationGraphController::computeNewPointOfInterestFromAbscissa(double start, int direction) {
-  double step = m_graphRange->xGridUnit()/10.0;
+  double step = updatePointsOfInterestCache();
   step = direction < 0 ? -step : step;
   double max = direction > 0 ? m_graphRange->xMax() : m_graphRange->xMin();
-  return computeNewPointOfInterest(start, step, max, textFieldDelegateApp()->localContext());
+  Ion::Storage::Record record;
+  Coordinate2D<double> pointOfInterest = m_pointsOfInterest.nextPointOfInterest(start, step, max, ComputePointOfInterest, this, &record);
+  if (!std::isnan(pointOfInterest.x1())) {
+    setPointOfInterestRecord(record);
+  }
+  return pointOfInterest;
+}
+
+Coordinate2D<double> CalculationGraphController::ComputePointOfInterest(double start, double step, double max, void * context, Ion::Storage::Record * record) {
+  CalculationGraphController * controller = static_cast<CalculationGraphController *>(context);
+  Coordinate2D<double> result = controller->computeNewPointOfInterest(start, step, max, controller->textFieldDelegateApp()->localContext());
+  *record = controller->pointOfInterestRecord();
+  return result;
+}
+
+double CalculationGraphController::updatePointsOfInterestCache() {
+  double step = m_graphRange->xGridUnit()/10.0;
+  Preferences * preferences = Preferences::sharedPreferences();
+  m_pointsOfInterest.setFunction(m_record, functionStore()->storeChecksum(), preferences->angleUnit(), preferences->complexFormat(), step);
+  return step;
+}
+
+bool CalculationGraphController::scanPointsOfInterest() {
+  updatePointsOfInterestCache();
+  // Computing points of interest changes the one the banner displays
+  Ion::Storage::Record record = pointOfInterestRecord();
+  bool scanIsIncomplete = m_pointsOfInterest.scanFurther(m_graphRange->xMax(), ComputePointOfInterest, this);
+  setPointOfInterestRecord(record);
+  return scanIsIncomplete;
 }
 
 ContinuousFunctionStore * CalculationGraphController::functionStore() const {
@@ -74,7 +109,31 @@ bool CalculationGraphController::moveCursorHorizontally(int direction, int scrol
   }
   assert(App::app()->functionStore()->modelForRecord(m_record)->plotType() == Shared::ContinuousFunction::PlotType::Cartesian);
   m_cursor->moveTo(newPointOfInterest.x1(), newPointOfInterest.x1(), newPointOfInterest.x2());
+  // Panning to the new point of interest may have extended the window
+  m_scanTimer.start();
   return true;
 }
 
+void CalculationGraphController::ScanTimer::start() {
+  if (!m_isRunning) {
+    TimerManager::AddTimer(this);
+    m_isRunning = true;
+  }
+}
+
+void CalculationGraphController::ScanTimer::stop() {
+  if (m_isRunning) {
+    TimerManager::RemoveTimer(this);
+    m_isRunning = false;
+  }
+}
+
+bool CalculationGraphController::ScanTimer::fire() {
+  if (!m_controller->scanPointsOfInterest()) {
+    stop();
+  }
+  // Nothing displayed changes
+  return false;
+}
+
 }
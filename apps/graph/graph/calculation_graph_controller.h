@@ -3,6 +3,7 @@
 
 #include "graph_view.h"
 #include "banner_view.h"
+#include "points_of_interest_cache.h"
 #include "../../shared/simple_interactive_curve_view_controller.h"
 #include "../../shared/function_banner_delegate.h"
 #include "../continuous_function_store.h"
@@ -15,6 +16,7 @@ class CalculationGraphController : public Shared::SimpleInteractiveCurveViewCont
 public:
   CalculationGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, I18n::Message defaultMessage);
   void viewWillAppear() override;
+  void viewDidDisappear() override;
   void setRecord(Ion::Storage::Record record);
 protected:
   float cursorBottomMarginRatio() override { return 0.15f; }
@@ -23,6 +25,10 @@ protected:
   Poincare::Coordinate2D<double> computeNewPointOfInterestFromAbscissa(double start, int direction);
   ContinuousFunctionStore * functionStore() const;
   virtual Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) = 0;
+  /* Points of interest are cached along with a record, the intersected
+   * function for intersections. */
+  virtual Ion::Storage::Record pointOfInterestRecord() const { return Ion::Storage::Record(); }
+  virtual void setPointOfInterestRecord(Ion::Storage::Record record) {}
   GraphView * m_graphView;
   BannerView * m_bannerView;
   Shared::InteractiveCurveViewRange * m_graphRange;
@@ -30,10 +36,28 @@ protected:
   MessageTextView m_defaultBannerView;
   bool m_isActive;
 private:
+  /* Between key events, the scan timer extends the cached points of interest
+   * to the right end of the window, one point per tick, so that moving the
+   * cursor right is a lookup. It stops once the window is scanned. */
+  class ScanTimer : public Timer {
+  public:
+    ScanTimer(CalculationGraphController * controller) : Timer(1), m_controller(controller), m_isRunning(false) {}
+    void start();
+    void stop();
+  private:
+    bool fire() override;
+    CalculationGraphController * m_controller;
+    bool m_isRunning;
+  };
+  static Poincare::Coordinate2D<double> ComputePointOfInterest(double start, double step, double max, void * context, Ion::Storage::Record * record);
+  double updatePointsOfInterestCache();
+  bool scanPointsOfInterest();
   bool handleEnter() override;
   bool moveCursorHorizontally(int direction, int scrollSpeed = 1) override;
   Shared::InteractiveCurveViewRange * interactiveCurveViewRange() override { return m_graphRange; }
   Shared::CurveView * curveView() override { return m_graphView; }
+  PointsOfInterestCache m_pointsOfInterest;
+  ScanTimer m_scanTimer;
 };
 
 }
@@ -67,6 +67,11 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
             ContinuousFunction * f = (ContinuousFunction *)model;
             Poincare::Context * c = (Poincare::Context *)context;
             return f->evaluateXYAtParameter(t, c);
+          },
+          [](double tStart, double tEnd, void * model, void * context) {
+            ContinuousFunction * f = (ContinuousFunction *)model;
+            Poincare::Context * c = (Poincare::Context *)context;
+            return f->enclosureOnRange(tStart, tEnd, c);
           });
       /* Draw tangent */
       if (m_tangent && record == m_selectedRecord) {
@@ -12,6 +12,8 @@ public:
 private:
   void reloadBannerView() override;
   Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) override;
+  Ion::Storage::Record pointOfInterestRecord() const override { return m_intersectedRecord; }
+  void setPointOfInterestRecord(Ion::Storage::Record record) override { m_intersectedRecord = record; }
   Ion::Storage::Record m_intersectedRecord;
   // Prevent horizontal panning to preserve search interval
   float cursorRightMarginRatio() override { return 0.0f; }
@@ -0,0 +1,97 @@
+#include "points_of_interest_cache.h"
+#include <assert.h>
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Graph {
+
+PointsOfInterestCache::PointsOfInterestCache() :
+  m_function(),
+  m_storeChecksum(0),
+  m_angleUnit(Preferences::AngleUnit::Radian),
+  m_complexFormat(Preferences::ComplexFormat::Real),
+  m_step(NAN)
+{
+  clear();
+}
+
+void PointsOfInterestCache::setFunction(Ion::Storage::Record function, uint32_t storeChecksum, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat, double step) {
+  step = std::fabs(step);
+  if (function != m_function || storeChecksum != m_storeChecksum || angleUnit != m_angleUnit || complexFormat != m_complexFormat || step != m_step) {
+    m_function = function;
+    m_storeChecksum = storeChecksum;
+    m_angleUnit = angleUnit;
+    m_complexFormat = complexFormat;
+    m_step = step;
+    clear();
+  }
+}
+
+void PointsOfInterestCache::clear() {
+  m_scanStart = NAN;
+  m_scanEnd = NAN;
+  m_numberOfPoints = 0;
+}
+
+Coordinate2D<double> PointsOfInterestCache::nextPointOfInterest(double start, double step, double max, ComputePointOfInterest compute, void * context, Ion::Storage::Record * record) {
+  assert(std::fabs(step) == m_step);
+  if (step > 0.0) {
+    if (std::isnan(m_scanStart)) {
+      m_scanStart = start;
+      m_scanEnd = start;
+    }
+    if (contains(start)) {
+      for (int i = 0; i < m_numberOfPoints; i++) {
+        if (m_points[i].x1() > start) {
+          *record = m_records[i];
+          return m_points[i].x1() <= max ? m_points[i] : Coordinate2D<double>(NAN, NAN);
+        }
+      }
+      if (m_scanEnd >= max) {
+        return Coordinate2D<double>(NAN, NAN);
+      }
+      if (m_numberOfPoints < k_maxNumberOfPointsOfInterest) {
+        // There is no point of interest between start and m_scanEnd
+        Coordinate2D<double> next = compute(m_scanEnd, step, max, context, record);
+        if (std::isnan(next.x1())) {
+          m_scanEnd = max;
+        } else if (next.x1() > m_scanEnd) {
+          m_points[m_numberOfPoints] = next;
+          m_records[m_numberOfPoints] = *record;
+          m_numberOfPoints++;
+          m_scanEnd = next.x1();
+        }
+        return next;
+      }
+    }
+  } else if (start > m_scanStart && contains(start)) {
+    for (int i = m_numberOfPoints - 1; i >= 0; i--) {
+      if (m_points[i].x1() < start) {
+        *record = m_records[i];
+        return m_points[i].x1() >= max ? m_points[i] : Coordinate2D<double>(NAN, NAN);
+      }
+    }
+    if (m_scanStart <= max) {
+      return Coordinate2D<double>(NAN, NAN);
+    }
+  }
+  return compute(start, step, max, context, record);
+}
+
+bool PointsOfInterestCache::scanFurther(double max, ComputePointOfInterest compute, void * context) {
+  if (std::isnan(m_scanStart) || m_scanEnd >= max || m_numberOfPoints == k_maxNumberOfPointsOfInterest) {
+    return false;
+  }
+  double scanEnd = m_scanEnd;
+  Ion::Storage::Record record;
+  nextPointOfInterest(scanEnd, m_step, max, compute, context, &record);
+  return scanEnd < m_scanEnd && m_scanEnd < max && m_numberOfPoints < k_maxNumberOfPointsOfInterest;
+}
+
+Coordinate2D<double> PointsOfInterestCache::pointOfInterestAtIndex(int i) const {
+  assert(i >= 0 && i < m_numberOfPoints);
+  return m_points[i];
+}
+
+}
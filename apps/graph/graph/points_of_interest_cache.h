@@ -0,0 +1,55 @@
+#ifndef GRAPH_POINTS_OF_INTEREST_CACHE_H
+#define GRAPH_POINTS_OF_INTEREST_CACHE_H
+
+#include <ion/storage.h>
+#include <poincare/coordinate_2D.h>
+#include <poincare/preferences.h>
+
+namespace Graph {
+
+/* PointsOfInterestCache memoizes the points of interest (roots, extrema or
+ * intersections) of a function, in increasing abscissa order, as they are
+ * found while the cursor moves from one to the next. The cache covers the
+ * interval [m_scanStart, m_scanEnd], in which it holds all the points of
+ * interest: moving the cursor inside it is a lookup, and moving past its end
+ * scans only from m_scanEnd on. Each point is stored with a record, which is
+ * the intersected function for intersections.
+ * Points of interest depend on the function, on the other records of the
+ * storage, on the angle unit and complex format with which expressions are
+ * approximated and on the scanning step, the cache is emptied when they
+ * change. */
+
+class PointsOfInterestCache {
+public:
+  /* ComputePointOfInterest returns the first point of interest after start
+   * in the direction of step, up to max, and sets record. */
+  typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(double start, double step, double max, void * context, Ion::Storage::Record * record);
+  constexpr static int k_maxNumberOfPointsOfInterest = 16;
+
+  PointsOfInterestCache();
+  void setFunction(Ion::Storage::Record function, uint32_t storeChecksum, Poincare::Preferences::AngleUnit angleUnit, Poincare::Preferences::ComplexFormat complexFormat, double step);
+  void clear();
+  Poincare::Coordinate2D<double> nextPointOfInterest(double start, double step, double max, ComputePointOfInterest compute, void * context, Ion::Storage::Record * record);
+  /* scanFurther extends the scanned interval by one point of interest towards
+   * max. It returns false when there is nothing left to scan, either because
+   * max is reached or because the cache is full. */
+  bool scanFurther(double max, ComputePointOfInterest compute, void * context);
+  int numberOfPointsOfInterest() const { return m_numberOfPoints; }
+  Poincare::Coordinate2D<double> pointOfInterestAtIndex(int i) const;
+private:
+  bool contains(double x) const { return m_scanStart <= x && x <= m_scanEnd; }
+  Ion::Storage::Record m_function;
+  uint32_t m_storeChecksum;
+  Poincare::Preferences::AngleUnit m_angleUnit;
+  Poincare::Preferences::ComplexFormat m_complexFormat;
+  double m_step;
+  double m_scanStart;
+  double m_scanEnd;
+  int m_numberOfPoints;
+  Poincare::Coordinate2D<double> m_points[k_maxNumberOfPointsOfInterest];
+  Ion::Storage::Record m_records[k_maxNumberOfPointsOfInterest];
+};
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include <quiz.h>
+#include "../graph/points_of_interest_cache.h"
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Graph {
+
+/* The points of interest of this fake function are the integers, each one
+ * related to the record "f<parity>.func". */
+
+struct FakeComputation {
+  int numberOfComputations;
+};
+
+Coordinate2D<double> fakeNextPointOfInterest(double start, double step, double max, void * context, Ion::Storage::Record * record) {
+  static_cast<FakeComputation *>(context)->numberOfComputations++;
+  double x = step > 0.0 ? std::floor(start) + 1.0 : std::ceil(start) - 1.0;
+  if ((step > 0.0 && x > max) || (step < 0.0 && x < max)) {
+    return Coordinate2D<double>(NAN, NAN);
+  }
+  *record = Ion::Storage::Record(static_cast<int>(std::fabs(x)) % 2 == 0 ? "f0.func" : "f1.func");
+  return Coordinate2D<double>(x, 2.0 * x);
+}
+
+void assert_next_point_of_interest_is(PointsOfInterestCache * cache, double start, double step, double max, double expectedX, FakeComputation * computation, int expectedNumberOfComputations) {
+  Ion::Storage::Record record;
+  int numberOfComputations = computation->numberOfComputations;
+  Coordinate2D<double> p = cache->nextPointOfInterest(start, step, max, fakeNextPointOfInterest, computation, &record);
+  if (std::isnan(expectedX)) {
+    quiz_assert(std::isnan(p.x1()));
+  } else {
+    quiz_assert(p.x1() == expectedX && p.x2() == 2.0 * expectedX);
+    quiz_assert(record == Ion::Storage::Record(static_cast<int>(std::fabs(expectedX)) % 2 == 0 ? "f0.func" : "f1.func"));
+  }
+  quiz_assert(computation->numberOfComputations - numberOfComputations == expectedNumberOfComputations);
+}
+
+constexpr Preferences::AngleUnit k_angleUnit = Preferences::AngleUnit::Radian;
+constexpr Preferences::ComplexFormat k_complexFormat = Preferences::ComplexFormat::Real;
+
+QUIZ_CASE(graph_points_of_interest_cache) {
+  PointsOfInterestCache cache;
+  FakeComputation computation = {0};
+  Ion::Storage::Record f("f.func");
+  constexpr double step = 0.1;
+  cache.setFunction(f, 1, k_angleUnit, k_complexFormat, step);
+
+  // Moving right from the left of the window computes each point once
+  assert_next_point_of_interest_is(&cache, -3.5, step, 3.5, -3.0, &computation, 1);
+  for (int x = -2; x <= 3; x++) {
+    assert_next_point_of_interest_is(&cache, x - 1, step, 3.5, x, &computation, 1);
+  }
+  assert_next_point_of_interest_is(&cache, 3.0, step, 3.5, NAN, &computation, 1);
+  quiz_assert(cache.numberOfPointsOfInterest() == 7);
+
+  // Moving back and forth is a lookup
+  for (int x = 2; x >= -3; x--) {
+    assert_next_point_of_interest_is(&cache, x + 1, -step, -3.5, x, &computation, 0);
+  }
+  assert_next_point_of_interest_is(&cache, -3.0, -step, -3.5, NAN, &computation, 0);
+  assert_next_point_of_interest_is(&cache, 0.5, step, 3.5, 1.0, &computation, 0);
+  assert_next_point_of_interest_is(&cache, 3.0, step, 3.5, NAN, &computation, 0);
+  // The window shrank
+  assert_next_point_of_interest_is(&cache, 1.0, step, 1.5, NAN, &computation, 0);
+
+  // Outside of the scanned interval, points are computed
+  assert_next_point_of_interest_is(&cache, -3.5, -step, -5.5, -4.0, &computation, 1);
+  // The window was panned to the right, the scan resumes at its end
+  assert_next_point_of_interest_is(&cache, 3.0, step, 5.5, 4.0, &computation, 1);
+  assert_next_point_of_interest_is(&cache, 2.0, step, 5.5, 3.0, &computation, 0);
+  quiz_assert(cache.numberOfPointsOfInterest() == 8);
+
+  // The cache is emptied when the storage changes
+  cache.setFunction(f, 1, k_angleUnit, k_complexFormat, -step);
+  quiz_assert(cache.numberOfPointsOfInterest() == 8);
+  cache.setFunction(f, 2, k_angleUnit, k_complexFormat, step);
+  quiz_assert(cache.numberOfPointsOfInterest() == 0);
+  assert_next_point_of_interest_is(&cache, 0.0, step, 3.5, 1.0, &computation, 1);
+
+  // And when the preferences used to approximate the functions change
+  cache.setFunction(f, 2, Preferences::AngleUnit::Degree, k_complexFormat, step);
+  quiz_assert(cache.numberOfPointsOfInterest() == 0);
+  assert_next_point_of_interest_is(&cache, 0.0, step, 3.5, 1.0, &computation, 1);
+  cache.setFunction(f, 2, Preferences::AngleUnit::Degree, Preferences::ComplexFormat::Cartesian, step);
+  quiz_assert(cache.numberOfPointsOfInterest() == 0);
+
+  // Past the cache capacity, points are computed
+  cache.setFunction(f, 3, k_angleUnit, k_complexFormat, step);
+  const int n = PointsOfInterestCache::k_maxNumberOfPointsOfInterest;
+  for (int x = 1; x <= n + 2; x++) {
+    assert_next_point_of_interest_is(&cache, x - 1, step, 100.0, x, &computation, 1);
+  }
+  assert_next_point_of_interest_is(&cache, n - 0.5, -step, 0.5, n - 1, &computation, 0);
+  assert_next_point_of_interest_is(&cache, n + 2, -step, 0.5, n + 1, &computation, 1);
+}
+
+QUIZ_CASE(graph_points_of_interest_cache_scan) {
+  PointsOfInterestCache cache;
+  FakeComputation computation = {0};
+  Ion::Storage::Record f("f.func");
+  constexpr double step = 0.1;
+  cache.setFunction(f, 1, k_angleUnit, k_complexFormat, step);
+
+  // Nothing is scanned before the cursor is placed
+  quiz_assert(!cache.scanFurther(3.5, fakeNextPointOfInterest, &computation));
+  quiz_assert(computation.numberOfComputations == 0);
+  assert_next_point_of_interest_is(&cache, -3.5, step, 3.5, -3.0, &computation, 1);
+
+  // The scan extends the cache one point at a time to the end of the window
+  for (int x = -2; x <= 3; x++) {
+    quiz_assert(cache.scanFurther(3.5, fakeNextPointOfInterest, &computation));
+    quiz_assert(cache.numberOfPointsOfInterest() == x + 4);
+  }
+  quiz_assert(!cache.scanFurther(3.5, fakeNextPointOfInterest, &computation));
+  quiz_assert(computation.numberOfComputations == 8);
+  quiz_assert(!cache.scanFurther(3.5, fakeNextPointOfInterest, &computation));
+  quiz_assert(computation.numberOfComputations == 8);
+
+  // Moving the cursor in the window is then a lookup
+  for (int x = -2; x <= 3; x++) {
+    assert_next_point_of_interest_is(&cache, x - 1, step, 3.5, x, &computation, 0);
+  }
+  assert_next_point_of_interest_is(&cache, 3.0, step, 3.5, NAN, &computation, 0);
+
+  // The scan stops when the cache is full
+  cache.setFunction(f, 2, k_angleUnit, k_complexFormat, step);
+  assert_next_point_of_interest_is(&cache, 0.0, step, 100.0, 1.0, &computation, 1);
+  int numberOfScans = 0;
+  while (cache.scanFurther(100.0, fakeNextPointOfInterest, &computation)) {
+    numberOfScans++;
+  }
+  quiz_assert(numberOfScans == PointsOfInterestCache::k_maxNumberOfPointsOfInterest - 2);
+  quiz_assert(cache.numberOfPointsOfInterest() == PointsOfInterestCache::k_maxNumberOfPointsOfInterest);
+}
+
+}
@@ -1,4 +1,5 @@
 #include <quiz.h>
+#include <poincare/context_with_parent.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -6,6 +7,22 @@ using namespace Shared;
 
 namespace Graph {
 
+/* In the real complex format, each evaluation of a function looks its unknown
+ * up in the context, to know whether the function is complex. Counting the
+ * lookups counts the evaluations. */
+class CountingContext : public ContextWithParent {
+public:
+  CountingContext(Context * parentContext) : ContextWithParent(parentContext), m_numberOfLookups(0) {}
+  const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) override {
+    m_numberOfLookups++; 
+    return ContextWithParent::expressionForSymbolAbstract(symbol, clone, unknownSymbolValue);
+  }
+  int numberOfLookups() const { return m_numberOfLookups; }
+  void resetNumberOfLookups() { m_numberOfLookups = 0; }
+private:
+  int m_numberOfLookups;
+};
+
 class AdHocGraphController : public InteractiveCurveViewRangeDelegate {
 public:
   /* These margins are obtained from instance methods of the various derived
@@ -16,9 +33,11 @@ public:
   static constexpr float k_leftMargin = 0.04f;
   static constexpr float k_rightMargin = 0.04f;
 
+  AdHocGraphController() : m_context(&m_globalContext) {}
+
   static float Ratio() { return InteractiveCurveViewRange::NormalYXRatio() / (1.f + k_topMargin + k_bottomMargin); }
 
-  Context * context() { return &m_context; }
+  CountingContext * context() { return &m_context; }
   ContinuousFunctionStore * functionStore() const { return &m_store; }
 
   // InteractiveCurveViewRangeDelegate
@@ -28,7 +47,8 @@ public:
   void updateZoomButtons() override {}
 
 private:
-  mutable GlobalContext m_context;
+  GlobalContext m_globalContext;
+  mutable CountingContext m_context;
   mutable ContinuousFunctionStore m_store;
 };
 
@@ -85,19 +105,19 @@ QUIZ_CASE(graph_ranges_single_function) {
   assert_best_cartesian_range_is("-2x^6", -10, 10, -16000, 2000);
   assert_best_cartesian_range_is("3x^2+x+10", -12, 11, 7.84062624, 20.0593758);
 
-  assert_best_cartesian_range_is("1/x", -4.51764774, 4.51764774, -2.60000014, 2.20000005);
+  assert_best_cartesian_range_is("1/x", -4.61176538, 4.61176538, -2.60000014, 2.29999995);
   assert_best_cartesian_range_is("1/(1-x)", -3.51176548, 5.71176529, -2.60000014, 2.29999995);
   assert_best_cartesian_range_is("1/(x^2+1)", -3.4000001, 3.4000001, -0.200000003, 1.10000002);
 
   assert_best_cartesian_range_is("sin(x)", -15, 15, -1.39999998, 1.20000005, Radian);
   assert_best_cartesian_range_is("cos(x)", -1000, 1000, -1.39999998, 1.20000005, Degree);
-  assert_best_cartesian_range_is("tan(x)", -1000, 1000, -3.9000001, 3.4000001, Gradian);
-  assert_best_cartesian_range_is("tan(x-100)", -1200, 1200, -4, 3.5, Gradian);
+  assert_best_cartesian_range_is("tan(x)", -1000, 1000, -2.5, 2.20000005, Gradian);
+  assert_best_cartesian_range_is("tan(x-100)", -1200, 1200, -4.5999999, 4, Gradian);
 
-  assert_best_cartesian_range_is("ℯ^x", -10, 10, -1.71249962, 8.91249943);
-  assert_best_cartesian_range_is("ℯ^x+4", -10, 10, 2.28750038, 12.9124994);
-  assert_best_cartesian_range_is("ℯ^(-x)", -10, 10, -1.71249962, 8.91249943);
-  assert_best_cartesian_range_is("(1-x)ℯ^(1/(1-x))", -1.8, 2.9, -3, 5.1);
+  assert_best_cartesian_range_is("ℯ^x", -10, 10, -1.66249943, 8.96249962);
+  assert_best_cartesian_range_is("ℯ^x+4", -10, 10, 2.33750057, 12.9624996);
+  assert_best_cartesian_range_is("ℯ^(-x)", -10, 10, -1.66249943, 8.96249962);
+  assert_best_cartesian_range_is("(1-x)ℯ^(1/(1-x))", -1.6, 2.7, -3, 5.5);
 
   assert_best_cartesian_range_is("ln(x)", -2.85294199, 8.25294113, -3.5, 2.4000001);
   assert_best_cartesian_range_is("log(x)", -0.900000036, 3.20000005, -1.23906231, 0.939062357);
@@ -125,6 +145,63 @@ QUIZ_CASE(graph_ranges_several_functions) {
   }
 }
 
+QUIZ_CASE(graph_ranges_memoization) {
+  Preferences::ComplexFormat complexFormat = Preferences::sharedPreferences()->complexFormat();
+  Preferences::sharedPreferences()->setComplexFormat(Preferences::ComplexFormat::Real);
+  Preferences::sharedPreferences()->setAngleUnit(Radian);
+  AdHocGraphController graphController;
+  InteractiveCurveViewRange graphRange(&graphController);
+  CountingContext * context = graphController.context();
+
+  /* The Y range and the range with a ratio are computed from the samples of
+   * the search for points of interest, which evaluates the function on 3
+   * points around the center of its grid and 190 on each side. */
+  addFunction("x", Cartesian, graphController.functionStore(), context);
+  context->resetNumberOfLookups();
+  graphRange.setDefault();
+  quiz_assert(context->numberOfLookups() > 0 && context->numberOfLookups() < 3 + 2 * 190 + 10);
+  graphController.functionStore()->removeAll();
+
+  const char * definitions[] = {"sin(x)", "ℯ^x", "ln(x)", "x(x-1)(x-2)(x-3)(x-4)(x-5)"};
+  for (const char * definition : definitions) {
+    addFunction(definition, Cartesian, graphController.functionStore(), context);
+  }
+  context->resetNumberOfLookups();
+  graphRange.setDefault();
+  quiz_assert(context->numberOfLookups() > 0);
+  float xMin = graphRange.xMin(), xMax = graphRange.xMax(), yMin = graphRange.yMin(), yMax = graphRange.yMax();
+
+  // The functions are not evaluated again if nothing changed
+  graphRange.setXMin(-1.f);
+  graphRange.setXMax(1.f);
+  context->resetNumberOfLookups();
+  graphRange.setDefault();
+  quiz_assert(context->numberOfLookups() == 0);
+  quiz_assert(graphRange.xMin() == xMin && graphRange.xMax() == xMax && graphRange.yMin() == yMin && graphRange.yMax() == yMax);
+
+  // Changing the angle unit changes the ranges of trigonometric functions
+  graphController.functionStore()->removeAll();
+  addFunction("sin(x)", Cartesian, graphController.functionStore(), context);
+  graphRange.setDefault();
+  quiz_assert(float_equal(graphRange.xMin(), -15) && float_equal(graphRange.xMax(), 15));
+  Preferences::sharedPreferences()->setAngleUnit(Degree);
+  graphRange.setDefault();
+  quiz_assert(graphRange.xMax() > 100.f);
+  Preferences::sharedPreferences()->setAngleUnit(Radian);
+
+  // Deactivating a function edits its record in place
+  addFunction("ℯ^x", Cartesian, graphController.functionStore(), context);
+  graphRange.setDefault();
+  graphController.functionStore()->modelForRecord(graphController.functionStore()->recordAtIndex(0))->setActive(false);
+  context->resetNumberOfLookups();
+  graphRange.setDefault();
+  quiz_assert(context->numberOfLookups() > 0);
+  quiz_assert(float_equal(graphRange.xMin(), -10) && float_equal(graphRange.xMax(), 10) && float_equal(graphRange.yMin(), -1.66249943) && float_equal(graphRange.yMax(), 8.96249962));
+
+  graphController.functionStore()->removeAll();
+  Preferences::sharedPreferences()->setComplexFormat(complexFormat);
+}
+
 void assert_zooms_to(float xMin, float xMax, float yMin, float yMax, float targetXMin, float targetXMax, float targetYMin, float targetYMax, bool conserveRatio, bool zoomIn) {
   float ratio = zoomIn ? 1.f / ZoomCurveViewController::k_zoomOutRatio : ZoomCurveViewController::k_zoomOutRatio;
 
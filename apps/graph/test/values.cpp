@@ -0,0 +1,105 @@
+#include <quiz.h>
+#include "../../shared/values_memoization.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+/* These values tables have numberOfColumns functions of numberOfElements
+ * abscissas, with k_numberOfDisplayedRows rows on screen. As the values
+ * controller of Graph, they memoize the cells of 4 columns. */
+
+constexpr int k_numberOfMemoizedColumns = 4;
+constexpr int k_numberOfDisplayedRows = 8;
+
+struct FakeEvaluation {
+  int numberOfEvaluations;
+};
+
+Coordinate2D<double> fakeEvaluateCell(int column, int row, void * context) {
+  static_cast<FakeEvaluation *>(context)->numberOfEvaluations++;
+  return Coordinate2D<double>(NAN, column + 0.5 * row);
+}
+
+void displayRows(ValuesMemoization * memoization, int firstDisplayedRow, int numberOfColumns, int numberOfElements, FakeEvaluation * evaluation) {
+  int lastDisplayedRow = std::min(firstDisplayedRow + k_numberOfDisplayedRows, numberOfElements);
+  for (int i = 0; i < numberOfColumns; i++) {
+    for (int j = firstDisplayedRow; j < lastDisplayedRow; j++) {
+      Coordinate2D<double> value = memoization->valueAtCell(i, j, fakeEvaluateCell, evaluation);
+      quiz_assert(value.x2() == i + 0.5 * j);
+    }
+  }
+}
+
+void prefetchRows(ValuesMemoization * memoization, int firstDisplayedRow, int direction, int numberOfColumns, int numberOfElements, FakeEvaluation * evaluation) {
+  int firstRow = ValuesMemoization::FirstPrefetchedRow(firstDisplayedRow, k_numberOfDisplayedRows, direction);
+  int lastRow = std::min(firstRow + ValuesMemoization::k_numberOfPrefetchedRows, numberOfElements);
+  for (int i = 0; i < numberOfColumns; i++) {
+    for (int j = std::max(firstRow, 0); j < lastRow; j++) {
+      memoization->valueAtCell(i, j, fakeEvaluateCell, evaluation);
+    }
+  }
+}
+
+void assert_scrolling_down_and_up_evaluates(int numberOfColumns, int numberOfElements, bool prefetch, int expectedNumberOfEvaluationsDown, int expectedNumberOfEvaluationsUp) {
+  ValuesMemoization::Value values[k_numberOfMemoizedColumns * ValuesMemoization::k_numberOfRows];
+  ValuesMemoization memoization(values, k_numberOfMemoizedColumns);
+  FakeEvaluation evaluation = {0};
+
+  // Select each row down to the last one, and scroll to keep it displayed
+  int firstDisplayedRow = 0;
+  displayRows(&memoization, firstDisplayedRow, numberOfColumns, numberOfElements, &evaluation);
+  for (int selectedRow = 1; selectedRow < numberOfElements; selectedRow++) {
+    if (selectedRow >= firstDisplayedRow + k_numberOfDisplayedRows) {
+      firstDisplayedRow++;
+      displayRows(&memoization, firstDisplayedRow, numberOfColumns, numberOfElements, &evaluation);
+    }
+    if (prefetch) {
+      prefetchRows(&memoization, firstDisplayedRow, 1, numberOfColumns, numberOfElements, &evaluation);
+    }
+  }
+  quiz_assert(evaluation.numberOfEvaluations == expectedNumberOfEvaluationsDown);
+
+  // Select each row back up to the first one
+  evaluation.numberOfEvaluations = 0;
+  for (int selectedRow = numberOfElements - 2; selectedRow >= 0; selectedRow--) {
+    if (selectedRow < firstDisplayedRow) {
+      firstDisplayedRow--;
+      displayRows(&memoization, firstDisplayedRow, numberOfColumns, numberOfElements, &evaluation);
+    }
+    if (prefetch) {
+      prefetchRows(&memoization, firstDisplayedRow, -1, numberOfColumns, numberOfElements, &evaluation);
+    }
+  }
+  quiz_assert(firstDisplayedRow == 0);
+  quiz_assert(evaluation.numberOfEvaluations == expectedNumberOfEvaluationsUp);
+
+  // Editing an abscissa forgets its row only
+  evaluation.numberOfEvaluations = 0;
+  for (int i = 0; i < numberOfColumns; i++) {
+    memoization.forgetCell(i, 1);
+  }
+  displayRows(&memoization, firstDisplayedRow, numberOfColumns, numberOfElements, &evaluation);
+  quiz_assert(evaluation.numberOfEvaluations == numberOfColumns);
+
+  // A reset forgets every cell
+  evaluation.numberOfEvaluations = 0;
+  memoization.reset();
+  displayRows(&memoization, firstDisplayedRow, numberOfColumns, numberOfElements, &evaluation);
+  quiz_assert(evaluation.numberOfEvaluations == numberOfColumns * std::min(k_numberOfDisplayedRows, numberOfElements));
+}
+
+QUIZ_CASE(graph_values_memoization) {
+  constexpr int maxNumberOfElements = Interval::k_maxNumberOfElements;
+  // Each cell is evaluated once on the way down, and never on the way up
+  assert_scrolling_down_and_up_evaluates(1, maxNumberOfElements, false, maxNumberOfElements, 0);
+  assert_scrolling_down_and_up_evaluates(1, maxNumberOfElements, true, maxNumberOfElements, 0);
+  assert_scrolling_down_and_up_evaluates(4, maxNumberOfElements, true, 4 * maxNumberOfElements, 0);
+  assert_scrolling_down_and_up_evaluates(2, 11, true, 2 * 11, 0);
+  assert_scrolling_down_and_up_evaluates(3, 5, false, 3 * 5, 0);
+}
+
+}
@@ -35,7 +35,8 @@ ValuesController::ValuesController(Responder * parentResponder, InputEventHandle
     }
     stack->push(intervalSelectorController);
     return true;
-  }, this), k_font)
+  }, this), k_font),
+  m_memoization(m_memoizedValues, k_maxNumberOfDisplayableFunctions)
 {
   for (int i = 0; i < k_maxNumberOfDisplayableFunctions; i++) {
     m_functionTitleCells[i].setOrientation(FunctionTitleCell::Orientation::HorizontalIndicator);
@@ -263,36 +264,33 @@ int ValuesController::absoluteColumnForValuesColumn(int column) {
   return column + abscissaColumns;
 }
 
-void ValuesController::fillMemoizedBuffer(int column, int row, int index) {
+Coordinate2D<double> ValuesController::evaluateAtLocation(int column, int row) {
   double abscissa = intervalAtColumn(column)->element(row-1); // Subtract the title row from row to get the element index
   bool isDerivative = false;
-  double evaluationX = NAN;
-  double evaluationY = NAN;
   Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
   Shared::ExpiringPointer<ContinuousFunction> function = functionStore()->modelForRecord(record);
   Poincare::Context * context = textFieldDelegateApp()->localContext();
-  bool isParametric = function->plotType() == ContinuousFunction::PlotType::Parametric;
   if (isDerivative) {
-    evaluationY = function->approximateDerivative(abscissa, context);
-  } else {
-    Poincare::Coordinate2D<double> eval = function->evaluate2DAtParameter(abscissa, context);
-    evaluationY = eval.x2();
-    if (isParametric) {
-      evaluationX = eval.x1();
-    }
+    return Coordinate2D<double>(NAN, function->approximateDerivative(abscissa, context));
   }
-  char * buffer = memoizedBufferAtIndex(index);
+  return function->evaluate2DAtParameter(abscissa, context);
+}
+
+void ValuesController::printEvaluation(char * buffer, int bufferSize, Coordinate2D<double> evaluation, int column) {
+  bool isDerivative = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+  bool isParametric = functionStore()->modelForRecord(record)->plotType() == ContinuousFunction::PlotType::Parametric;
   int numberOfChar = 0;
   if (isParametric) {
-    assert(numberOfChar < k_valuesCellBufferSize-1);
+    assert(numberOfChar < bufferSize-1);
     buffer[numberOfChar++] = '(';
-    numberOfChar += PoincareHelpers::ConvertFloatToText<double>(evaluationX, buffer+numberOfChar, k_valuesCellBufferSize - numberOfChar, Preferences::LargeNumberOfSignificantDigits);
-    assert(numberOfChar < k_valuesCellBufferSize-1);
+    numberOfChar += PoincareHelpers::ConvertFloatToText<double>(evaluation.x1(), buffer+numberOfChar, bufferSize - numberOfChar, Preferences::LargeNumberOfSignificantDigits);
+    assert(numberOfChar < bufferSize-1);
     buffer[numberOfChar++] = ';';
   }
-  numberOfChar += PoincareHelpers::ConvertFloatToText<double>(evaluationY, buffer+numberOfChar, k_valuesCellBufferSize - numberOfChar, Preferences::LargeNumberOfSignificantDigits);
+  numberOfChar += PoincareHelpers::ConvertFloatToText<double>(evaluation.x2(), buffer+numberOfChar, bufferSize - numberOfChar, Preferences::LargeNumberOfSignificantDigits);
   if (isParametric) {
-    assert(numberOfChar+1 < k_valuesCellBufferSize-1);
+    assert(numberOfChar+1 < bufferSize-1);
     buffer[numberOfChar++] = ')';
     buffer[numberOfChar] = 0;
   }
@@ -49,6 +49,7 @@ private:
   static constexpr int k_maxNumberOfDisplayableFunctions = 4;
   static constexpr int k_maxNumberOfDisplayableAbscissaCells = Shared::ContinuousFunction::k_numberOfPlotTypes * k_maxNumberOfDisplayableRows;
   static constexpr int k_maxNumberOfDisplayableCells = k_maxNumberOfDisplayableFunctions * k_maxNumberOfDisplayableRows;
+  static constexpr int k_numberOfMemoizedValues = k_maxNumberOfDisplayableFunctions * Shared::ValuesMemoization::k_numberOfRows;
 
   // Values controller
   void setStartEndMessages(Shared::IntervalParameterController * controller, int column) override;
@@ -73,19 +74,14 @@ private:
   Shared::ContinuousFunction::PlotType plotTypeAtColumn(int * i) const;
 
   // Function evaluation memoization
-  static constexpr int k_valuesCellBufferSize = 2*Poincare::PrintFloat::charSizeForFloatsWithPrecision(Poincare::Preferences::LargeNumberOfSignificantDigits)+3; // The largest buffer holds (-1.234567E-123;-1.234567E-123)
-  char * memoizedBufferAtIndex(int i) override {
-    assert(i >= 0 && i < k_maxNumberOfDisplayableCells);
-    return m_memoizedBuffer[i];
-  }
-  int valuesCellBufferSize() const override { return k_valuesCellBufferSize; }
-  int numberOfMemoizedColumn() override { return k_maxNumberOfDisplayableFunctions; }
+  Shared::ValuesMemoization * memoization() override { return &m_memoization; }
   /* The conversion of column coordinates from the absolute table to the table
    * on only values cell depends on the number of abscissa columns which depends
    * on the number of different plot types in the table. */
   int valuesColumnForAbsoluteColumn(int column) override;
   int absoluteColumnForValuesColumn(int column) override;
-  void fillMemoizedBuffer(int i, int j, int index) override;
+  Poincare::Coordinate2D<double> evaluateAtLocation(int i, int j) override;
+  void printEvaluation(char * buffer, int bufferSize, Poincare::Coordinate2D<double> evaluation, int column) override;
 
   // Parameter controllers
   ViewController * functionParameterController() override;
@@ -126,8 +122,8 @@ private:
   IntervalParameterSelectorController m_intervalParameterSelectorController;
   DerivativeParameterController m_derivativeParameterController;
   Button m_setIntervalButton;
-  // TODO specialize buffer size as well
-  mutable char m_memoizedBuffer[k_maxNumberOfDisplayableCells][k_valuesCellBufferSize];
+  Shared::ValuesMemoization::Value m_memoizedValues[k_numberOfMemoizedValues];
+  Shared::ValuesMemoization m_memoization;
 };
 
 }
@@ -7,9 +7,13 @@
 #include "parameters_controller.h"
 #include "../shared/text_field_delegate_app.h"
 #include "distribution/binomial_distribution.h"
+#include "distribution/chi_squared_distribution.h"
 #include "distribution/exponential_distribution.h"
+#include "distribution/fisher_distribution.h"
+#include "distribution/geometric_distribution.h"
 #include "distribution/normal_distribution.h"
 #include "distribution/poisson_distribution.h"
+#include "distribution/student_distribution.h"
 #include "distribution/uniform_distribution.h"
 #include "calculation/left_integral_calculation.h"
 #include "calculation/right_integral_calculation.h"
@@ -49,7 +53,7 @@ public:
     void setActivePage(Page activePage);
 
   private:
-    constexpr static int k_distributionSizes[] = {sizeof(BinomialDistribution),sizeof(ExponentialDistribution), sizeof(NormalDistribution), sizeof(PoissonDistribution), sizeof(UniformDistribution), 0};
+    constexpr static int k_distributionSizes[] = {sizeof(BinomialDistribution), sizeof(ChiSquaredDistribution), sizeof(ExponentialDistribution), sizeof(FisherDistribution), sizeof(GeometricDistribution), sizeof(NormalDistribution), sizeof(PoissonDistribution), sizeof(StudentDistribution), sizeof(UniformDistribution), 0};
     constexpr static size_t k_distributionSize = max(k_distributionSizes);
     constexpr static int k_calculationSizes[] = {sizeof(LeftIntegralCalculation),sizeof(FiniteIntegralCalculation), sizeof(RightIntegralCalculation), 0};
     constexpr static size_t k_calculationSize = max(k_calculationSizes);
@@ -58,7 +62,7 @@ public:
     void initializeDistributionAndCalculation();
 
 #if (defined __EMSCRIPTEN__) || (defined _FXCG)
-    constexpr static int k_distributionAlignments[] = {alignof(BinomialDistribution),alignof(ExponentialDistribution), alignof(NormalDistribution), alignof(PoissonDistribution), alignof(UniformDistribution), 0};
+    constexpr static int k_distributionAlignments[] = {alignof(BinomialDistribution), alignof(ChiSquaredDistribution), alignof(ExponentialDistribution), alignof(FisherDistribution), alignof(GeometricDistribution), alignof(NormalDistribution), alignof(PoissonDistribution), alignof(StudentDistribution), alignof(UniformDistribution), 0};
     constexpr static size_t k_distributionAlignment = max(k_distributionAlignments);
     constexpr static int k_calculationAlignments[] = {alignof(LeftIntegralCalculation),alignof(FiniteIntegralCalculation), alignof(RightIntegralCalculation), 0};
     constexpr static size_t k_calculationAlignment = max(k_calculationAlignments);
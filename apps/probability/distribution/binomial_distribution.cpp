@@ -2,6 +2,7 @@
 #include <poincare/binomial_distribution.h>
 #include <assert.h>
 #include <cmath>
+#include <float.h>
 
 namespace Probability {
 
@@ -62,7 +63,13 @@ bool BinomialDistribution::authorizedValueAtIndex(float x, int index) const {
 }
 
 double BinomialDistribution::cumulativeDistributiveInverseForProbability(double * probability) {
-  return Poincare::BinomialDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, m_parameter1, m_parameter2);
+  if (*probability < DBL_EPSILON || *probability > 1.0 - DBL_EPSILON || !Poincare::BinomialDistribution::ParametersAreOK(m_parameter1, m_parameter2)) {
+    return Poincare::BinomialDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, m_parameter1, m_parameter2);
+  }
+  /* The memoized cumulative probabilities give the same result as Poincare's
+   * inverse, which does not update the probability either. */
+  double p = *probability;
+  return Distribution::cumulativeDistributiveInverseForProbability(&p);
 }
 
 double BinomialDistribution::rightIntegralInverseForProbability(double * probability) {
@@ -2,6 +2,7 @@
 #define PROBABILITE_BINOMIAL_DISTRIBUTION_H
 
 #include "two_parameter_distribution.h"
+#include "cumulative_table.h"
 
 namespace Probability {
 
@@ -22,6 +23,10 @@ public:
   double rightIntegralInverseForProbability(double * probability) override;
 protected:
   double evaluateAtDiscreteAbscissa(int k) const override;
+private:
+  void parametersDidChange() override { m_cumulativeTable.invalidate(); }
+  CumulativeTable * cumulativeTable() const override { return &m_cumulativeTable; }
+  mutable CumulativeTable m_cumulativeTable;
 };
 
 }
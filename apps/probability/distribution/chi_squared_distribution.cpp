@@ -1,5 +1,6 @@
 #include "chi_squared_distribution.h"
 #include "regularized_gamma.h"
+#include <poincare/normal_distribution.h>
 #include <cmath>
 #include <algorithm>
 
@@ -30,7 +31,7 @@ float ChiSquaredDistribution::evaluateAtAbscissa(float x) const {
   }
   const float halfk = m_parameter1/2.0;
   const float halfX = x/2.0f;
-  return std::exp(-lgamma(halfk) - halfX + (halfk-1.0f) * std::log(halfX)) / 2.0f;
+  return std::exp(-m_lnGammaHalfK - halfX + (halfk-1.0f) * std::log(halfX)) / 2.0f;
 }
 
 bool ChiSquaredDistribution::authorizedValueAtIndex(float x, int index) const {
@@ -43,7 +44,7 @@ double ChiSquaredDistribution::cumulativeDistributiveFunctionAtAbscissa(double x
     return 0.0;
   }
   double result = 0.0;
-  if (regularizedGamma(m_parameter1/2.0, x/2.0, k_regularizedGammaPrecision, k_maxRegularizedGammaIterations, &result)) {
+  if (regularizedGamma(m_parameter1/2.0, x/2.0, k_regularizedGammaPrecision, k_maxRegularizedGammaIterations, &result, m_lnGammaHalfK)) {
     return result;
   }
   return NAN;
@@ -78,7 +79,30 @@ double ChiSquaredDistribution::cumulativeDistributiveInverseForProbability(doubl
     2.0 * *probability * std::exp(std::lgamma(ceilKOver2)) / (exp(-kOver2Minus1) * std::pow(kOver2Minus1, kOver2Minus1)) :
     30.0; // Ad hoc value
   xmax = std::isnan(xmax) ? 1000000000.0 : xmax;
-  return cumulativeDistributiveInverseForProbabilityUsingIncreasingFunctionRoot(probability, FLT_EPSILON, std::max<double>(xMax(), xmax));
+  /* Wilson-Hilferty approximation: (x/k)^(1/3) is approximately normal, of
+   * mean 1-2/(9k) and variance 2/(9k). */
+  const double h = 2.0 / (9.0 * k);
+  const double z = Poincare::NormalDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, 0.0, 1.0);
+  double initialGuess = k * std::pow(1.0 - h + z * std::sqrt(h), 3.0);
+  if (!(initialGuess > 0.0)) {
+    // Close to 0, the cumulative distributive function is (x/2)^(k/2)/gamma(k/2+1)
+    initialGuess = 2.0 * std::exp((std::log(*probability) + std::lgamma(k/2.0 + 1.0)) * 2.0 / k);
+  }
+  xmax = std::max<double>(std::max<double>(xMax(), xmax), 2.0 * initialGuess);
+  return cumulativeDistributiveInverseForProbabilityUsingNewton(probability, initialGuess, 0.0, xmax);
+}
+
+double ChiSquaredDistribution::densityAtAbscissa(double x) const {
+  if (x <= 0.0) {
+    return 0.0;
+  }
+  const double halfk = m_parameter1/2.0;
+  return std::exp((halfk - 1.0) * std::log(x/2.0) - x/2.0 - m_lnGammaHalfK) / 2.0;
+}
+
+void ChiSquaredDistribution::parametersDidChange() {
+  OneParameterDistribution::parametersDidChange();
+  m_lnGammaHalfK = std::lgamma(m_parameter1/2.0);
 }
 
 }
@@ -11,7 +11,7 @@ public:
   static constexpr int k_maxRegularizedGammaIterations = 1000;
   static constexpr double k_regularizedGammaPrecision = DBL_EPSILON;
 
-  ChiSquaredDistribution() : OneParameterDistribution(1.0f) {}
+  ChiSquaredDistribution() : OneParameterDistribution(1.0f) { parametersDidChange(); }
   I18n::Message title() override { return I18n::Message::ChiSquaredDistribution; }
   Type type() const override { return Type::ChiSquared; }
   bool isContinuous() const override { return true; }
@@ -30,8 +30,12 @@ public:
   bool authorizedValueAtIndex(float x, int index) const override;
   double cumulativeDistributiveFunctionAtAbscissa(double x) const override;
   double cumulativeDistributiveInverseForProbability(double * probability) override;
+protected:
+  double densityAtAbscissa(double x) const override;
+  void parametersDidChange() override;
 private:
   static constexpr double k_maxK = 31500.0;
+  double m_lnGammaHalfK;
 };
 
 }
@@ -0,0 +1,77 @@
+#include "cumulative_table.h"
+#include "distribution.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Probability {
+
+void CumulativeTable::invalidate() {
+  m_numberOfCheckpoints = 0;
+  m_stride = k_initialStride;
+}
+
+double CumulativeTable::cumulativeProbabilityAtIndex(int k, const Distribution * distribution) {
+  if (k < 0) {
+    return 0.0;
+  }
+  while (m_numberOfCheckpoints * m_stride <= k && !std::isnan(m_numberOfCheckpoints > 0 ? m_checkpoints[m_numberOfCheckpoints - 1] : 0.0)) {
+    addCheckpoint(distribution);
+  }
+  int numberOfCheckpoints = std::min(m_numberOfCheckpoints, (k + 1) / m_stride);
+  double result = numberOfCheckpoints > 0 ? m_checkpoints[numberOfCheckpoints - 1] : 0.0;
+  for (int i = numberOfCheckpoints * m_stride; i <= k; i++) {
+    result += distribution->evaluateAtDiscreteAbscissa(i);
+  }
+  return result;
+}
+
+int CumulativeTable::firstIndexReachingProbability(double probability, const Distribution * distribution, double * cumulativeProbability) {
+  constexpr int maxIndex = Distribution::k_maxNumberOfOperations;
+  /* Find the first checkpoint reaching probability. Comparisons with NaN are
+   * false, so a NaN checkpoint ends the search. */
+  while ((m_numberOfCheckpoints == 0 || m_checkpoints[m_numberOfCheckpoints - 1] < probability) && m_numberOfCheckpoints * m_stride <= maxIndex) {
+    addCheckpoint(distribution);
+  }
+  int lower = 0;
+  int upper = m_numberOfCheckpoints;
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (m_checkpoints[middle] < probability) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  // Then sum from the previous checkpoint
+  int k = lower * m_stride;
+  double result = lower > 0 ? m_checkpoints[lower - 1] : 0.0;
+  while (true) {
+    result += distribution->evaluateAtDiscreteAbscissa(k);
+    if (!(result < probability) || k >= maxIndex) {
+      break;
+    }
+    k++;
+  }
+  *cumulativeProbability = result;
+  return k;
+}
+
+void CumulativeTable::addCheckpoint(const Distribution * distribution) {
+  if (m_numberOfCheckpoints == k_numberOfCheckpoints) {
+    for (int i = 0; i < k_numberOfCheckpoints / 2; i++) {
+      m_checkpoints[i] = m_checkpoints[2*i + 1];
+    }
+    m_numberOfCheckpoints = k_numberOfCheckpoints / 2;
+    m_stride *= 2;
+    return;
+  }
+  int start = m_numberOfCheckpoints * m_stride;
+  double result = m_numberOfCheckpoints > 0 ? m_checkpoints[m_numberOfCheckpoints - 1] : 0.0;
+  for (int i = start; i < start + m_stride; i++) {
+    result += distribution->evaluateAtDiscreteAbscissa(i);
+  }
+  m_checkpoints[m_numberOfCheckpoints++] = result;
+}
+
+}
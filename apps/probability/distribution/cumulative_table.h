@@ -0,0 +1,41 @@
+#ifndef PROBABILITE_CUMULATIVE_TABLE_H
+#define PROBABILITE_CUMULATIVE_TABLE_H
+
+namespace Probability {
+
+class Distribution;
+
+/* CumulativeTable memoizes the cumulative probabilities of a discrete
+ * distribution, so that they are not summed from 0 at each computation.
+ *
+ * The probabilities are always added in the same order, from 0, so a memoized
+ * sum is exactly the one that would be computed from scratch. One cumulative
+ * probability every m_stride values is kept. When the table is full, every
+ * other one is dropped and the stride is doubled, so that the table covers any
+ * range in a bounded memory. */
+
+class CumulativeTable {
+public:
+  CumulativeTable() { invalidate(); }
+  // To be called when the parameters of the distribution change
+  void invalidate();
+  // Sum of the probabilities of 0 to k
+  double cumulativeProbabilityAtIndex(int k, const Distribution * distribution);
+  /* Smallest index whose cumulative probability is greater than or equal to
+   * probability, looked for up to Distribution::k_maxNumberOfOperations. The
+   * cumulative probability at that index is put in cumulativeProbability. */
+  int firstIndexReachingProbability(double probability, const Distribution * distribution, double * cumulativeProbability);
+private:
+  constexpr static int k_numberOfCheckpoints = 64;
+  constexpr static int k_initialStride = 8;
+  // The next checkpoint is computed, or the stride doubled if the table is full
+  void addCheckpoint(const Distribution * distribution);
+  // m_checkpoints[i] is the cumulative probability at index (i+1)*m_stride-1
+  double m_checkpoints[k_numberOfCheckpoints];
+  int m_numberOfCheckpoints;
+  int m_stride;
+};
+
+}
+
+#endif
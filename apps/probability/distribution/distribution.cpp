@@ -1,5 +1,7 @@
 #include "distribution.h"
+#include "cumulative_table.h"
 #include <poincare/solver.h>
+#include <algorithm>
 #include <cmath>
 #include <float.h>
 
@@ -7,12 +9,17 @@ namespace Probability {
 
 double Distribution::cumulativeDistributiveFunctionAtAbscissa(double x) const {
   if (!isContinuous()) {
-    return Poincare::Solver::CumulativeDistributiveFunctionForNDefinedFunction<double>(x,
-        [](double k, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
-        const Distribution * distribution = reinterpret_cast<const Distribution *>(context1);
-        return distribution->evaluateAtDiscreteAbscissa(k);
-      }, nullptr, Poincare::Preferences::ComplexFormat::Real, Poincare::Preferences::AngleUnit::Degree, this);
-    // Context, complex format and angle unit are dummy values
+    double end = std::round(x);
+    if (std::isnan(end)) {
+      return NAN;
+    }
+    if (end < 0.0) {
+      return 0.0;
+    }
+    // The sum stops after k_maxNumberOfOperations to avoid too long loops
+    int k = end > k_maxNumberOfOperations ? k_maxNumberOfOperations + 1 : static_cast<int>(end);
+    double result = cumulativeTable()->cumulativeProbabilityAtIndex(k, this);
+    return result >= k_maxProbability ? 1.0 : result;
   }
   return 0.0;
 }
@@ -61,12 +68,10 @@ double Distribution::cumulativeDistributiveInverseForProbability(double * probab
   if (*probability < DBL_EPSILON) {
     return -1.0;
   }
-  return Poincare::Solver::CumulativeDistributiveInverseForNDefinedFunction<double>(probability,
-        [](double k, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
-        const Distribution * distribution = reinterpret_cast<const Distribution *>(context1);
-        return distribution->evaluateAtDiscreteAbscissa(k);
-      }, nullptr, Poincare::Preferences::ComplexFormat::Real, Poincare::Preferences::AngleUnit::Degree, this);
-    // Context, complex format and angle unit are dummy values
+  double cumulativeProbability;
+  double result = closestCumulativeIndex(*probability, &cumulativeProbability);
+  *probability = std::isinf(result) ? 1.0 : cumulativeProbability;
+  return result;
 }
 
 double Distribution::rightIntegralInverseForProbability(double * probability) {
@@ -80,26 +85,40 @@ double Distribution::rightIntegralInverseForProbability(double * probability) {
   if (*probability <= 0.0) {
     return INFINITY;
   }
-  double p = 0.0;
-  int k = 0;
-  double delta = 0.0;
-  do {
-    delta = std::fabs(1.0-*probability-p);
-    p += evaluateAtDiscreteAbscissa(k++);
-    if (p >= k_maxProbability && std::fabs(1.0-*probability-p) <= delta) {
-      *probability = 0.0;
-      return k;
-    }
-  } while (std::fabs(1.0-*probability-p) <= delta && k < k_maxNumberOfOperations);
-  if (k == k_maxNumberOfOperations) {
-    *probability = 1.0;
+  /* P(X >= k) = 1 - P(X <= k-1), so k-1 is the index whose cumulative
+   * probability is the closest to 1 - probability. */
+  double cumulativeProbability;
+  double result = closestCumulativeIndex(1.0 - *probability, &cumulativeProbability);
+  *probability = std::isinf(result) ? 1.0 : 1.0 - cumulativeProbability;
+  return result + 1.0;
+}
+
+double Distribution::closestCumulativeIndex(double probability, double * cumulativeProbability) const {
+  assert(!isContinuous());
+  /* Cumulative probabilities above k_maxProbability are considered to be 1, so
+   * there is no need to look further. */
+  double target = std::min(probability, k_maxProbability);
+  double upperCumulativeProbability;
+  int k = cumulativeTable()->firstIndexReachingProbability(target, this, &upperCumulativeProbability);
+  if (std::isnan(upperCumulativeProbability)) {
+    *cumulativeProbability = NAN;
+    return NAN;
+  }
+  if (upperCumulativeProbability < target) {
+    // Avoid too long loops
     return INFINITY;
   }
-  *probability = 1.0 - (p - evaluateAtDiscreteAbscissa(k-1));
-  if (std::isnan(*probability)) {
-    return NAN;
+  if (upperCumulativeProbability >= k_maxProbability) {
+    upperCumulativeProbability = 1.0;
   }
-  return k-1.0;
+  // The cumulative probabilities of k-1 and k surround probability
+  double lowerCumulativeProbability = cumulativeTable()->cumulativeProbabilityAtIndex(k - 1, this);
+  if (std::fabs(probability - upperCumulativeProbability) <= std::fabs(probability - lowerCumulativeProbability)) {
+    *cumulativeProbability = upperCumulativeProbability;
+    return k;
+  }
+  *cumulativeProbability = lowerCumulativeProbability;
+  return k - 1;
 }
 
 double Distribution::evaluateAtDiscreteAbscissa(int k) const {
@@ -141,6 +160,46 @@ double Distribution::cumulativeDistributiveInverseForProbabilityUsingIncreasingF
    return result.x1();
 }
 
+double Distribution::cumulativeDistributiveInverseForProbabilityUsingNewton(double * probability, double initialGuess, double ax, double bx) {
+  assert(ax < bx);
+  if (*probability > 1.0 - DBL_EPSILON) {
+    return INFINITY;
+  }
+  if (*probability < DBL_EPSILON) {
+    return -INFINITY;
+  }
+  /* [a, b] always surrounds the result. A Newton step leaving it, or taken on
+   * a flat or undefined density, is replaced with a bisection step. */
+  double a = ax;
+  double b = bx;
+  double x = initialGuess > a && initialGuess < b ? initialGuess : (a + b) / 2.0;
+  for (int i = 0; i < k_maxNumberOfNewtonSteps; i++) {
+    double error = cumulativeDistributiveFunctionAtAbscissa(x) - *probability;
+    if (std::isnan(error)) {
+      break;
+    }
+    if (error == 0.0) {
+      return x;
+    }
+    if (error < 0.0) {
+      a = x;
+    } else {
+      b = x;
+    }
+    double density = densityAtAbscissa(x);
+    double nextX = x - error / density;
+    bool isNewtonStep = density > 0.0 && std::isfinite(density) && nextX > a && nextX < b;
+    if (!isNewtonStep) {
+      nextX = (a + b) / 2.0;
+    }
+    if (std::fabs(nextX - x) <= 2.0 * DBL_EPSILON * std::fabs(x) || nextX == a || nextX == b) {
+      return isNewtonStep ? nextX : x;
+    }
+    x = nextX;
+  }
+  return cumulativeDistributiveInverseForProbabilityUsingIncreasingFunctionRoot(probability, ax, bx);
+}
+
 float Distribution::yMin() const {
   return -k_displayBottomMarginRatio * yMax();
 }
@@ -4,9 +4,12 @@
 #include "../../shared/curve_view_range.h"
 #include <apps/i18n.h>
 #include <poincare/preferences.h>
+#include <cmath>
 
 namespace Probability {
 
+class CumulativeTable;
+
 class Distribution : public Shared::CurveViewRange {
 public:
   Distribution() : Shared::CurveViewRange() {}
@@ -46,10 +49,26 @@ protected:
   constexpr static float k_displayTopMarginRatio = 0.05f;
   constexpr static float k_displayLeftMarginRatio = 0.05f;
   constexpr static float k_displayRightMarginRatio = 0.05f;
+  // Density of the continuous distributions, in double precision
+  virtual double densityAtAbscissa(double x) const { return NAN; }
   double cumulativeDistributiveInverseForProbabilityUsingIncreasingFunctionRoot(double * probability, double ax, double bx);
+  /* Newton's method from the initial guess, kept within [ax, bx] by bisection.
+   * It falls back on the increasing function root if it does not converge. */
+  double cumulativeDistributiveInverseForProbabilityUsingNewton(double * probability, double initialGuess, double ax, double bx);
+  /* Must be called when the parameters change. Distributions override it to
+   * update the terms which only depend on the parameters. */
+  virtual void parametersDidChange() {}
+  /* Discrete distributions memoize their cumulative probabilities. The table is
+   * only stored in them, it is not needed by the continuous ones. */
+  virtual CumulativeTable * cumulativeTable() const { return nullptr; }
 private:
   constexpr static float k_displayBottomMarginRatio = 0.2f;
+  constexpr static int k_maxNumberOfNewtonSteps = 100;
   float yMin() const override;
+  /* Index whose cumulative probability is the closest to probability, -1
+   * standing for the empty sum. Its cumulative probability is put in
+   * cumulativeProbability. */
+  double closestCumulativeIndex(double probability, double * cumulativeProbability) const;
 };
 
 }
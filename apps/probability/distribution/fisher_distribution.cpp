@@ -1,5 +1,6 @@
 #include "fisher_distribution.h"
 #include <poincare/beta_function.h>
+#include <poincare/normal_distribution.h>
 #include <poincare/regularized_incomplete_beta_function.h>
 #include <cmath>
 #include <float.h>
@@ -46,7 +47,7 @@ float FisherDistribution::evaluateAtAbscissa(float x) const {
   const float d2 = m_parameter2;
   const float f = d1*x/(d1*x+d2);
   const float numerator = std::pow(f, d1/2.0f) * std::pow(1.0f - f, d2/2.0f);
-  const float denominator = x * Poincare::BetaFunction(d1/2.0f, d2/2.0f);
+  const float denominator = x * std::exp(m_lnBeta);
   return numerator / denominator;
 }
 
@@ -60,7 +61,7 @@ void FisherDistribution::setParameterAtIndex(float f, int index) {
 }
 
 double FisherDistribution::cumulativeDistributiveFunctionAtAbscissa(double x) const {
-  return Poincare::RegularizedIncompleteBetaFunction(m_parameter1/2.0, m_parameter2/2.0, m_parameter1*x/(m_parameter1*x+m_parameter2));
+  return Poincare::RegularizedIncompleteBetaFunction(m_parameter1/2.0, m_parameter2/2.0, m_parameter1*x/(m_parameter1*x+m_parameter2), m_lnBeta);
 }
 
 double FisherDistribution::cumulativeDistributiveInverseForProbability(double * probability) {
@@ -71,7 +72,41 @@ double FisherDistribution::cumulativeDistributiveInverseForProbability(double *
   if (*probability < DBL_EPSILON) {
     return 0.0;
   }
-  return cumulativeDistributiveInverseForProbabilityUsingIncreasingFunctionRoot(probability, DBL_EPSILON, std::max<double>(xMax(), 100.0));  // Ad-hoc value;
+  /* Paulson approximation: with a = 2/(9*d1) and b = 2/(9*d2), the variable
+   * ((1-b)*x^(1/3) - (1-a)) / sqrt(b*x^(2/3) + a) is approximately standard
+   * normal. Solving it for x^(1/3) gives the initial guess. */
+  const double a = 2.0 / (9.0 * m_parameter1);
+  const double b = 2.0 / (9.0 * m_parameter2);
+  const double z = Poincare::NormalDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, 0.0, 1.0);
+  const double denominator = (1.0 - b) * (1.0 - b) - z * z * b;
+  const double discriminant = (1.0 - b) * (1.0 - b) * a + (1.0 - a) * (1.0 - a) * b - z * z * a * b;
+  double initialGuess = 1.0;
+  if (denominator > 0.0 && discriminant >= 0.0) {
+    double cubicRoot = ((1.0 - a) * (1.0 - b) + z * std::sqrt(discriminant)) / denominator;
+    if (cubicRoot > 0.0) {
+      initialGuess = cubicRoot * cubicRoot * cubicRoot;
+    }
+  }
+  // Widen the ad-hoc interval for large quantiles
+  double xmax = std::max<double>(std::max<double>(xMax(), 100.0), 2.0 * initialGuess);
+  while (cumulativeDistributiveFunctionAtAbscissa(xmax) < *probability && xmax < k_maxQuantile) {
+    xmax *= 10.0;
+  }
+  return cumulativeDistributiveInverseForProbabilityUsingNewton(probability, initialGuess, 0.0, xmax);
+}
+
+double FisherDistribution::densityAtAbscissa(double x) const {
+  if (x <= 0.0) {
+    return 0.0;
+  }
+  const double d1 = m_parameter1;
+  const double d2 = m_parameter2;
+  return std::exp((d1 * std::log(d1) + d2 * std::log(d2)) / 2.0 + (d1 / 2.0 - 1.0) * std::log(x) - (d1 + d2) / 2.0 * std::log(d1 * x + d2) - m_lnBeta);
+}
+
+void FisherDistribution::parametersDidChange() {
+  TwoParameterDistribution::parametersDidChange();
+  m_lnBeta = Poincare::LnBetaFunction(m_parameter1/2.0, m_parameter2/2.0);
 }
 
 float FisherDistribution::mode() const {
@@ -7,7 +7,7 @@ namespace Probability {
 
 class FisherDistribution final : public TwoParameterDistribution {
 public:
-  FisherDistribution() : TwoParameterDistribution(1.0f, 1.0f) {}
+  FisherDistribution() : TwoParameterDistribution(1.0f, 1.0f) { parametersDidChange(); }
   I18n::Message title() override { return I18n::Message::FisherDistribution; }
   Type type() const override { return Type::Fisher; }
   bool isContinuous() const override { return true; }
@@ -21,10 +21,16 @@ public:
   void setParameterAtIndex(float f, int index) override;
   double cumulativeDistributiveFunctionAtAbscissa(double x) const override;
   double cumulativeDistributiveInverseForProbability(double * probability) override;
+protected:
+  double densityAtAbscissa(double x) const override;
+  void parametersDidChange() override;
 private:
   constexpr static float k_maxParameter = 144.0f; // The display works badly for d1 = d2 > 144.
+  constexpr static double k_maxQuantile = 1E10;
   constexpr static float k_defaultMax = 3.0f;
   float mode() const;
+  // ln(B(d1/2, d2/2)), used by the density and the cumulative distributive function
+  double m_lnBeta;
 };
 
 }
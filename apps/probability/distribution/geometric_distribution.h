@@ -2,6 +2,7 @@
 #define PROBABILITE_GEOMETRIC_DISTRIBUTION_H
 
 #include "one_parameter_distribution.h"
+#include "cumulative_table.h"
 
 namespace Probability {
 
@@ -32,10 +33,13 @@ public:
   bool authorizedValueAtIndex(float x, int index) const override;
   double defaultComputedValue() const override { return 1.0; }
 private:
+  void parametersDidChange() override { m_cumulativeTable.invalidate(); }
+  CumulativeTable * cumulativeTable() const override { return &m_cumulativeTable; }
   double evaluateAtDiscreteAbscissa(int k) const override {
     return templatedApproximateAtAbscissa<double>(static_cast<double>(k));
   }
   template<typename T> T templatedApproximateAtAbscissa(T x) const;
+  mutable CumulativeTable m_cumulativeTable;
 };
 
 }
@@ -17,6 +17,7 @@ public:
   void setParameterAtIndex(float f, int index) override {
     assert(index == 0);
     m_parameter1 = f;
+    parametersDidChange();
   }
 protected:
   double m_parameter1;
@@ -2,6 +2,7 @@
 #define PROBABILITE_POISSON_DISTRIBUTION_H
 
 #include "one_parameter_distribution.h"
+#include "cumulative_table.h"
 
 namespace Probability {
 
@@ -27,10 +28,13 @@ public:
   }
   bool authorizedValueAtIndex(float x, int index) const override;
 private:
+  void parametersDidChange() override { m_cumulativeTable.invalidate(); }
+  CumulativeTable * cumulativeTable() const override { return &m_cumulativeTable; }
   double evaluateAtDiscreteAbscissa(int k) const override {
     return templatedApproximateAtAbscissa<double>(static_cast<double>(k));
   }
   template<typename T> T templatedApproximateAtAbscissa(T x) const;
+  mutable CumulativeTable m_cumulativeTable;
 };
 
 }
@@ -6,6 +6,10 @@
 #include <assert.h>
 
 bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result) {
+  return regularizedGamma(s, x, epsilon, maxNumberOfIterations, result, std::lgamma(s));
+}
+
+bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result, double lnGammaS) {
   // TODO Put interruption instead of maxNumberOfIterations
 
   assert(!std::isnan(s) && !std::isnan(x) && s > 0.0 && x >= 0.0);
@@ -58,7 +62,7 @@ bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterati
     {
       return false;
     }
-    *result = 1.0 - std::exp(-x + s*std::log(x) - std::lgamma(s)) * ( 1.0 / continuedFractionValue);
+    *result = 1.0 - std::exp(-x + s*std::log(x) - lnGammaS) * ( 1.0 / continuedFractionValue);
     return true;
   }
 
@@ -76,6 +80,6 @@ bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterati
   {
     return false;
   }
-  *result = std::isinf(infiniteSeriesValue) ? 1.0 : std::exp(-x + s*std::log(x) -  std::lgamma(s)) * infiniteSeriesValue;
+  *result = std::isinf(infiniteSeriesValue) ? 1.0 : std::exp(-x + s*std::log(x) -  lnGammaS) * infiniteSeriesValue;
   return true;
 }
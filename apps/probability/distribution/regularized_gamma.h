@@ -7,6 +7,8 @@
  * regularizedGamma(s, inf) = 1 */
 
 bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result);
+// Same function, with lnGammaS = lgamma(s) given by the caller
+bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result, double lnGammaS);
 
 #endif
 
@@ -1,4 +1,6 @@
 #include "student_distribution.h"
+#include <poincare/beta_function.h>
+#include <poincare/normal_distribution.h>
 #include <poincare/regularized_incomplete_beta_function.h>
 #include "helper.h"
 #include <cmath>
@@ -37,9 +39,14 @@ double StudentDistribution::cumulativeDistributiveFunctionAtAbscissa(double x) c
    * k = 0.001 and P(x < 42000000) (for 41000000 it is around 0.5)
    * k = 0.01 and P(x < 8400000) (for 41000000 it is around 0.6) */
   const double k = m_parameter1;
+  /* The distribution being symmetric, the computation is done for -|x|:
+   * x + sqrt(x^2+k) = k / (sqrt(x^2+k) - x) avoids a catastrophic
+   * cancellation for large |x|. */
+  const double negativeX = -std::fabs(x);
   const double sqrtXSquaredPlusK = std::sqrt(x*x + k);
-  double t = (x + sqrtXSquaredPlusK) / (2.0 * sqrtXSquaredPlusK);
-  return Poincare::RegularizedIncompleteBetaFunction(k/2.0, k/2.0, t);
+  double t = k / (2.0 * sqrtXSquaredPlusK * (sqrtXSquaredPlusK - negativeX));
+  double result = Poincare::RegularizedIncompleteBetaFunction(k/2.0, k/2.0, t, m_lnBeta);
+  return x < 0.0 ? result : 1.0 - result;
 }
 
 double StudentDistribution::cumulativeDistributiveInverseForProbability(double * probability) {
@@ -50,12 +57,30 @@ double StudentDistribution::cumulativeDistributiveInverseForProbability(double *
   const double big = 1E10;
   double xmin = *probability < 0.5 ? -big : small;
   double xmax = *probability < 0.5 ? -small : big;
-  return cumulativeDistributiveInverseForProbabilityUsingIncreasingFunctionRoot(probability, xmin, xmax);
+  /* Cornish-Fisher expansion of the quantile around the normal one, in powers
+   * of 1/k. It diverges for small k, the initial guess being then ignored. */
+  const double k = m_parameter1;
+  const double z = Poincare::NormalDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, 0.0, 1.0);
+  const double z2 = z * z;
+  const double g1 = z * (z2 + 1.0) / 4.0;
+  const double g2 = z * ((5.0 * z2 + 16.0) * z2 + 3.0) / 96.0;
+  const double g3 = z * (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) / 384.0;
+  double initialGuess = z + (g1 + (g2 + g3 / k) / k) / k;
+  return cumulativeDistributiveInverseForProbabilityUsingNewton(probability, initialGuess, xmin, xmax);
 }
 
-float StudentDistribution::lnCoefficient() const {
-  const float k = m_parameter1;
-  return std::lgamma((k+1.0f)/2.0f) - std::lgamma(k/2.0f) - ((float)M_PI+k)/2.0f;
+double StudentDistribution::densityAtAbscissa(double x) const {
+  const double k = m_parameter1;
+  return std::exp(m_lnDensityCoefficient - (k + 1.0) / 2.0 * std::log1p(x * x / k));
+}
+
+void StudentDistribution::parametersDidChange() {
+  OneParameterDistribution::parametersDidChange();
+  const float kf = m_parameter1;
+  m_lnCoefficient = std::lgamma((kf+1.0f)/2.0f) - std::lgamma(kf/2.0f) - ((float)M_PI+kf)/2.0f;
+  const double k = m_parameter1;
+  m_lnDensityCoefficient = std::lgamma((k + 1.0) / 2.0) - std::lgamma(k / 2.0) - std::log(k * M_PI) / 2.0;
+  m_lnBeta = Poincare::LnBetaFunction(k / 2.0, k / 2.0);
 }
 
 }
@@ -8,7 +8,7 @@ namespace Probability {
 
 class StudentDistribution : public OneParameterDistribution {
 public:
-  StudentDistribution() : OneParameterDistribution(1.0f) {}
+  StudentDistribution() : OneParameterDistribution(1.0f) { parametersDidChange(); }
   I18n::Message title() override { return I18n::Message::StudentDistribution; }
   Type type() const override { return Type::Student; }
   bool isContinuous() const override { return true; }
@@ -27,8 +27,15 @@ public:
   bool authorizedValueAtIndex(float x, int index) const override;
   double cumulativeDistributiveFunctionAtAbscissa(double x) const override;
   double cumulativeDistributiveInverseForProbability(double * probability) override;
+protected:
+  double densityAtAbscissa(double x) const override;
+  void parametersDidChange() override;
 private:
-  float lnCoefficient() const;
+  float lnCoefficient() const { return m_lnCoefficient; }
+  // Terms of the density and of the cumulative distributive function
+  float m_lnCoefficient;
+  double m_lnDensityCoefficient;
+  double m_lnBeta;
 };
 
 }
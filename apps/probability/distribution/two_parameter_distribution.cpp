@@ -18,6 +18,7 @@ void TwoParameterDistribution::setParameterAtIndex(float f, int index) {
   } else {
     m_parameter2 = f;
   }
+  parametersDidChange();
 }
 
 }
@@ -1,4 +1,5 @@
 #include <quiz.h>
+#include <quiz/stopwatch.h>
 #include <string.h>
 #include <assert.h>
 #include <float.h>
@@ -153,3 +154,40 @@ QUIZ_CASE(fisher_distribution) {
   assert_finite_integral_between_abscissas_is(&distribution, 2.0, 1.0, 0.0);
   assert_finite_integral_between_abscissas_is(&distribution, 1.0, 2.0, 0.19555555555555555);
 }
+
+void draw_distribution_curve(Probability::Distribution * distribution, float * sum) {
+  /* The curve view evaluates the density once per pixel column, and the
+   * calculation evaluates the cumulative distributive function at its bounds.
+   * Nothing evaluates the cumulative distributive function along the curve. */
+  constexpr int k_numberOfColumns = 320;
+  float xMin = distribution->xMin();
+  float xMax = distribution->xMax();
+  float step = (xMax - xMin) / k_numberOfColumns;
+  for (int i = 0; i < k_numberOfColumns; i++) {
+    // The density is undefined left of 0 for some distributions
+    float y = distribution->evaluateAtAbscissa(xMin + i * step);
+    *sum += std::isnan(y) ? 0.0f : y;
+  }
+  double p = distribution->finiteIntegralBetweenAbscissas((2.0f * xMin + xMax) / 3.0f, (xMin + 2.0f * xMax) / 3.0f);
+  *sum += std::isnan(p) ? 0.0f : p;
+}
+
+QUIZ_CASE(probability_curves_benchmark) {
+  Probability::FisherDistribution fisher;
+  fisher.setParameterAtIndex(100.0, 0);
+  fisher.setParameterAtIndex(87.0, 1);
+  Probability::StudentDistribution student;
+  student.setParameterAtIndex(30.0, 0);
+  Probability::ChiSquaredDistribution chiSquared;
+  chiSquared.setParameterAtIndex(50.0, 0);
+  Probability::Distribution * distributions[] = {&fisher, &student, &chiSquared};
+  for (Probability::Distribution * distribution : distributions) {
+    float sum = 0.0f;
+    uint64_t startTime = quiz_stopwatch_start();
+    for (int i = 0; i < 100; i++) {
+      draw_distribution_curve(distribution, &sum);
+    }
+    quiz_stopwatch_print_lap(startTime);
+    quiz_assert(sum > 0.0f && !std::isinf(sum));
+  }
+}
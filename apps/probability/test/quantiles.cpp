@@ -0,0 +1,119 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <float.h>
+#include <cmath>
+#include "../distribution/binomial_distribution.h"
+#include "../distribution/chi_squared_distribution.h"
+#include "../distribution/geometric_distribution.h"
+#include "../distribution/student_distribution.h"
+#include "../distribution/fisher_distribution.h"
+
+static const double k_probabilities[] = {1E-9, 1E-4, 0.01, 0.1, 0.3, 0.5, 0.7, 0.9, 0.99, 0.9999, 1.0 - 1E-9};
+
+void assert_continuous_quantiles_round_trip(Probability::Distribution * distribution) {
+  for (double p : k_probabilities) {
+    double probability = p;
+    double x = distribution->cumulativeDistributiveInverseForProbability(&probability);
+    quiz_assert(!std::isnan(x) && !std::isinf(x));
+    if (std::fabs(x) < DBL_EPSILON) {
+      // Cumulative distributive functions are rounded to 0 below DBL_EPSILON
+      continue;
+    }
+    double r = distribution->cumulativeDistributiveFunctionAtAbscissa(x);
+    // The regularized incomplete beta and gamma functions are precise to 1E-8
+    quiz_assert(std::fabs(r - p) <= 1E-7 * p);
+  }
+}
+
+void assert_discrete_quantiles_round_trip(Probability::Distribution * distribution) {
+  // The left inverse returns the abscissa whose cumulated probability is the closest to p
+  for (double p : k_probabilities) {
+    double probability = p;
+    double x = distribution->cumulativeDistributiveInverseForProbability(&probability);
+    quiz_assert(!std::isnan(x) && x == std::round(x));
+    if (std::isinf(x)) {
+      continue;
+    }
+    double upper = distribution->cumulativeDistributiveFunctionAtAbscissa(x);
+    double lower = distribution->cumulativeDistributiveFunctionAtAbscissa(x - 1.0);
+    double next = distribution->cumulativeDistributiveFunctionAtAbscissa(x + 1.0);
+    quiz_assert(lower <= p + DBL_EPSILON);
+    quiz_assert(std::fabs(upper - p) <= std::fabs(lower - p) + DBL_EPSILON);
+    quiz_assert(std::fabs(upper - p) <= std::fabs(next - p) + DBL_EPSILON || next <= p);
+  }
+}
+
+QUIZ_CASE(probability_chi_squared_quantiles) {
+  Probability::ChiSquaredDistribution distribution;
+  const double degreesOfFreedom[] = {0.5, 1.0, 2.0, 3.5, 10.0, 100.0, 999.0};
+  for (double k : degreesOfFreedom) {
+    distribution.setParameterAtIndex(k, 0);
+    assert_continuous_quantiles_round_trip(&distribution);
+  }
+}
+
+QUIZ_CASE(probability_student_quantiles) {
+  Probability::StudentDistribution distribution;
+  const double degreesOfFreedom[] = {1.0, 2.0, 5.0, 30.0, 200.0};
+  for (double k : degreesOfFreedom) {
+    distribution.setParameterAtIndex(k, 0);
+    assert_continuous_quantiles_round_trip(&distribution);
+  }
+}
+
+QUIZ_CASE(probability_fisher_quantiles) {
+  Probability::FisherDistribution distribution;
+  const double degreesOfFreedom[] = {1.0, 3.0, 10.0, 50.0, 144.0};
+  // For d2 = 1, the extreme quantiles are beyond the searched interval
+  const double denominatorDegreesOfFreedom[] = {3.0, 10.0, 50.0, 144.0};
+  for (double d1 : degreesOfFreedom) {
+    for (double d2 : denominatorDegreesOfFreedom) {
+      distribution.setParameterAtIndex(d1, 0);
+      distribution.setParameterAtIndex(d2, 1);
+      assert_continuous_quantiles_round_trip(&distribution);
+    }
+  }
+}
+
+QUIZ_CASE(probability_discrete_quantiles) {
+  Probability::BinomialDistribution binomial;
+  const double numbersOfTrials[] = {1.0, 20.0, 300.0};
+  const double successProbabilities[] = {0.01, 0.5, 0.97};
+  for (double n : numbersOfTrials) {
+    for (double p : successProbabilities) {
+      binomial.setParameterAtIndex(n, 0);
+      binomial.setParameterAtIndex(p, 1);
+      assert_discrete_quantiles_round_trip(&binomial);
+    }
+  }
+  Probability::GeometricDistribution geometric;
+  const double geometricProbabilities[] = {0.001, 0.2, 0.9};
+  for (double p : geometricProbabilities) {
+    geometric.setParameterAtIndex(p, 0);
+    assert_discrete_quantiles_round_trip(&geometric);
+  }
+}
+
+QUIZ_CASE(probability_quantiles_benchmark) {
+  /* Each lap computes quantiles for large parameters, where the former
+   * bracketing methods needed the most evaluations of the cumulative
+   * distributive function. */
+  Probability::ChiSquaredDistribution chiSquared;
+  chiSquared.setParameterAtIndex(999.0, 0);
+  Probability::FisherDistribution fisher;
+  fisher.setParameterAtIndex(144.0, 0);
+  fisher.setParameterAtIndex(144.0, 1);
+  Probability::GeometricDistribution geometric;
+  geometric.setParameterAtIndex(0.001, 0);
+  Probability::Distribution * distributions[] = {&chiSquared, &fisher, &geometric};
+  for (Probability::Distribution * distribution : distributions) {
+    uint64_t startTime = quiz_stopwatch_start();
+    double sum = 0.0;
+    for (int i = 1; i < 100; i++) {
+      double probability = i / 100.0;
+      sum += distribution->cumulativeDistributiveInverseForProbability(&probability);
+    }
+    quiz_stopwatch_print_lap(startTime);
+    quiz_assert(sum > 0.0 && !std::isinf(sum));
+  }
+}
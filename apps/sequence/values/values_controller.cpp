@@ -29,7 +29,8 @@ ValuesController::ValuesController(Responder * parentResponder, InputEventHandle
      * used and we set them in ValuesController::ValuesController(...) */
     stack->push(controller);
     return true;
-  }, this), k_font)
+  }, this), k_font),
+  m_memoization(m_memoizedValues, k_maxNumberOfDisplayableSequences)
 {
   for (int i = 0; i < k_maxNumberOfDisplayableSequences; i++) {
     m_sequenceTitleCells[i].setOrientation(Shared::FunctionTitleCell::Orientation::HorizontalIndicator);
@@ -93,12 +94,14 @@ Shared::Interval * ValuesController::intervalAtColumn(int columnIndex) {
 
 // Function evaluation memoization
 
-void ValuesController::fillMemoizedBuffer(int column, int row, int index) {
-  char * buffer = memoizedBufferAtIndex(index);
+Coordinate2D<double> ValuesController::evaluateAtLocation(int column, int row) {
   double abscissa = intervalAtColumn(column)->element(row-1); // Subtract the title row from row to get the element index
   Shared::ExpiringPointer<Shared::Sequence> sequence = functionStore()->modelForRecord(recordAtColumn(column));
-  Coordinate2D<double> xy = sequence->evaluateXYAtParameter(abscissa, textFieldDelegateApp()->localContext());
-  Shared::PoincareHelpers::ConvertFloatToText<double>(xy.x2(), buffer, k_valuesCellBufferSize, Preferences::LargeNumberOfSignificantDigits);
+  return sequence->evaluateXYAtParameter(abscissa, textFieldDelegateApp()->localContext());
+}
+
+void ValuesController::printEvaluation(char * buffer, int bufferSize, Coordinate2D<double> evaluation, int column) {
+  Shared::PoincareHelpers::ConvertFloatToText<double>(evaluation.x2(), buffer, bufferSize, Preferences::LargeNumberOfSignificantDigits);
 }
 
 // Parameters controllers getter
@@ -31,6 +31,7 @@ public:
 private:
   constexpr static int k_maxNumberOfDisplayableSequences = 3;
   constexpr static int k_maxNumberOfDisplayableCells = k_maxNumberOfDisplayableSequences * k_maxNumberOfDisplayableRows;
+  constexpr static int k_numberOfMemoizedValues = k_maxNumberOfDisplayableSequences * Shared::ValuesMemoization::k_numberOfRows;
 
   // ValuesController
   void setStartEndMessages(Shared::IntervalParameterController * controller, int column) override {
@@ -50,14 +51,9 @@ private:
   Shared::Interval * intervalAtColumn(int columnIndex) override;
 
   // Function evaluation memoization
-  static constexpr int k_valuesCellBufferSize = Poincare::PrintFloat::charSizeForFloatsWithPrecision(Poincare::Preferences::LargeNumberOfSignificantDigits);
-  char * memoizedBufferAtIndex(int i) override {
-    assert(i >= 0 && i < k_maxNumberOfDisplayableCells);
-    return m_memoizedBuffer[i];
-  }
-  int valuesCellBufferSize() const override{ return k_valuesCellBufferSize; }
-  int numberOfMemoizedColumn() override { return k_maxNumberOfDisplayableSequences; }
-  void fillMemoizedBuffer(int i, int j, int index) override;
+  Shared::ValuesMemoization * memoization() override { return &m_memoization; }
+  Poincare::Coordinate2D<double> evaluateAtLocation(int i, int j) override;
+  void printEvaluation(char * buffer, int bufferSize, Poincare::Coordinate2D<double> evaluation, int column) override;
 
 
   // Parameters controllers getter
@@ -94,7 +90,8 @@ private:
 #endif
   IntervalParameterController m_intervalParameterController;
   Button m_setIntervalButton;
-  mutable char m_memoizedBuffer[k_maxNumberOfDisplayableCells][k_valuesCellBufferSize];
+  Shared::ValuesMemoization::Value m_memoizedValues[k_numberOfMemoizedValues];
+  Shared::ValuesMemoization m_memoization;
 };
 
 }
@@ -124,6 +124,7 @@ void ContinuousFunction::setPlotType(PlotType newPlotType, Poincare::Preferences
   }
 
   recordData()->setPlotType(newPlotType);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
 
   setCache(nullptr);
 
@@ -205,12 +206,23 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
   return Coordinate2D<T>(x1x2.x2() * std::cos(angle), x1x2.x2() * std::sin(angle));
 }
 
+Enclosure ContinuousFunction::enclosureOnRange(double tStart, double tEnd, Context * context) const {
+  if (plotType() != PlotType::Cartesian || tStart < tMin() || tEnd > tMax()) {
+    return Enclosure::Unknown();
+  }
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  return Enclosure::ForExpression(expressionReduced(context), unknown, tStart, tEnd, Preferences::sharedPreferences()->angleUnit());
+}
+
 bool ContinuousFunction::displayDerivative() const {
   return recordData()->displayDerivative();
 }
 
 void ContinuousFunction::setDisplayDerivative(bool display) {
-  return recordData()->setDisplayDerivative(display);
+  recordData()->setDisplayDerivative(display);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
 }
 
 int ContinuousFunction::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
@@ -253,11 +265,13 @@ float ContinuousFunction::tMax() const {
 
 void ContinuousFunction::setTMin(float tMin) {
   recordData()->setTMin(tMin);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
   setCache(nullptr);
 }
 
 void ContinuousFunction::setTMax(float tMax) {
   recordData()->setTMax(tMax);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
   setCache(nullptr);
 }
 
@@ -270,29 +284,29 @@ void ContinuousFunction::rangeForDisplay(float * xMin, float * xMax, float * yMi
   }
 
   if (!basedOnCostlyAlgorithms(context)) {
-    Zoom::ValueAtAbscissa evaluation = [](float x, Context * context, const void * auxiliary) -> float {
-      /* When evaluating sin(x)/x close to zero using the standard sine function,
-       * one can detect small variations, while the cardinal sine is supposed to be
-       * locally monotonous. To smooth our such variations, we round the result of
-       * the evaluations. As we are not interested in precise results but only in
-       * ordering, this approximation is sufficient. */
-      constexpr float precision = 1e-5;
-      return precision * std::round(static_cast<const Function *>(auxiliary)->evaluateXYAtParameter(x, context).x2() / precision);
-    };
-    bool fullyComputed = Zoom::InterestingRangesForDisplay(evaluation, xMin, xMax, yMin, yMax, tMin(), tMax(), context, this);
-
-    evaluation = [](float x, Context * context, const void * auxiliary) {
+    Zoom::ValueAtAbscissa evaluation = [](float x, Context * context, const void * auxiliary) {
       return static_cast<const Function *>(auxiliary)->evaluateXYAtParameter(x, context).x2();
     };
+    /* When evaluating sin(x)/x close to zero using the standard sine function,
+     * one can detect small variations, while the cardinal sine is supposed to be
+     * locally monotonous. To smooth our such variations, the search for points
+     * of interest rounds the result of the evaluations. As we are not
+     * interested in precise results but only in ordering, this approximation
+     * is sufficient. */
+    constexpr float precision = 1e-5;
+    /* The samples of the search for points of interest are reused to compute
+     * the Y range and the range with a ratio. */
+    Zoom::Samples samples;
+    bool fullyComputed = Zoom::InterestingRangesForDisplay(evaluation, xMin, xMax, yMin, yMax, tMin(), tMax(), context, this, precision, &samples);
 
     if (fullyComputed) {
       /* The function has points of interest. */
-      Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, this);
+      Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, this, &samples);
       return;
     }
 
     /* Try to display an orthonormal range. */
-    Zoom::RangeWithRatioForDisplay(evaluation, targetRatio, xMin, xMax, yMin, yMax, context, this);
+    Zoom::RangeWithRatioForDisplay(evaluation, targetRatio, xMin, xMax, yMin, yMax, context, this, &samples);
     if (std::isfinite(*xMin) && std::isfinite(*xMax) && std::isfinite(*yMin) && std::isfinite(*yMax)) {
       return;
     }
@@ -301,7 +315,7 @@ void ContinuousFunction::rangeForDisplay(float * xMin, float * xMax, float * yMi
      * Try a basic range. */
     *xMin = - Zoom::k_defaultHalfRange;
     *xMax = Zoom::k_defaultHalfRange;
-    Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, this);
+    Zoom::RefinedYRangeForDisplay(evaluation, xMin, xMax, yMin, yMax, context, this, &samples);
     if (std::isfinite(*xMin) && std::isfinite(*xMax) && std::isfinite(*yMin) && std::isfinite(*yMax)) {
       return;
     }
@@ -15,6 +15,7 @@
 #include "range_1D.h"
 #include <poincare/symbol.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/enclosure.h>
 
 namespace Shared {
 
@@ -53,6 +54,9 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const override {
     return privateEvaluateXYAtParameter<double>(t, context);
   }
+  /* Enclose the values of a cartesian function on [tStart, tEnd]. The
+   * enclosure is Unknown for other plot types. */
+  Poincare::Enclosure enclosureOnRange(double tStart, double tEnd, Poincare::Context * context) const;
 
   // Derivative
   bool displayDerivative() const;
@@ -658,7 +658,7 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd
   } while (!isLastSegment);
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, EncloseYForXRange yEnclosure) const {
   float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
   float rectRight = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
   float tStart = std::isnan(rectLeft) ? xMin : std::max(xMin, rectLeft);
@@ -668,7 +668,98 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, flo
     return;
   }
   float tStep = pixelWidth();
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation);
+  /* The area under the curve is colored sample by sample: the enclosures
+   * cannot be used where it is colored. */
+  bool colorsUnderCurve = colorUnderCurve && colorLowerBound < tEnd && tStart < colorUpperBound;
+  if (yEnclosure == nullptr || colorsUnderCurve) {
+    drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation);
+    return;
+  }
+  int numberOfColumns = std::ceil((tEnd - tStart) / tStep);
+  int firstSampledColumn = -1;
+  drawEnclosedCartesianCurve(ctx, rect, tStart, tEnd, tStep, 0, numberOfColumns, &firstSampledColumn, yEnclosure, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+  drawSampledColumns(ctx, rect, tStart, tEnd, tStep, numberOfColumns, &firstSampledColumn, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+}
+
+void CurveView::drawEnclosedCartesianCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, int firstColumn, int lastColumn, int * firstSampledColumn, EncloseYForXRange yEnclosure, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+  /* Below this number of columns, the ranges of bounded curve are sampled
+   * rather than split, as their enclosures rarely allow to skip them. */
+  constexpr int k_minimalNumberOfEnclosedColumns = 4;
+  assert(firstColumn < lastColumn);
+  float t = tStart + firstColumn * tStep;
+  float s = std::min(tStart + lastColumn * tStep, tEnd);
+  Enclosure enclosure = yEnclosure(t, s, model, context);
+  if (enclosure.status() == Enclosure::Status::Unknown) {
+    // The curve cannot be enclosed, sample it
+    if (*firstSampledColumn < 0) {
+      *firstSampledColumn = firstColumn;
+    }
+    return;
+  }
+  if (enclosure.status() == Enclosure::Status::Undefined || !enclosureIsVisible(rect, enclosure, thick)) {
+    drawSampledColumns(ctx, rect, tStart, tEnd, tStep, firstColumn, firstSampledColumn, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+    return;
+  }
+  int numberOfColumns = lastColumn - firstColumn;
+  if (enclosure.isBounded()) {
+    if (enclosure.isDefined() && floatLengthToPixelLength(Axis::Vertical, enclosure.max() - enclosure.min()) <= 1.0f) {
+      // The curve is flat: draw it in one segment
+      drawSampledColumns(ctx, rect, tStart, tEnd, tStep, firstColumn, firstSampledColumn, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+      float py = floatToPixel(Axis::Vertical, (enclosure.min() + enclosure.max()) / 2.0);
+      straightJoinDots(ctx, rect, floatToPixel(Axis::Horizontal, t), py, floatToPixel(Axis::Horizontal, s), py, color, thick);
+      return;
+    }
+    if (numberOfColumns <= k_minimalNumberOfEnclosedColumns) {
+      if (*firstSampledColumn < 0) {
+        *firstSampledColumn = firstColumn;
+      }
+      return;
+    }
+  } else if (numberOfColumns == 1) {
+    // The curve may have an asymptote in this column
+    drawSampledColumns(ctx, rect, tStart, tEnd, tStep, firstColumn, firstSampledColumn, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+    drawAroundAsymptote(ctx, rect, t, s, yEnclosure, xyFloatEvaluation, model, context, color, thick, k_maxNumberOfIterations, xyDoubleEvaluation);
+    return;
+  }
+  int middleColumn = firstColumn + numberOfColumns / 2;
+  drawEnclosedCartesianCurve(ctx, rect, tStart, tEnd, tStep, firstColumn, middleColumn, firstSampledColumn, yEnclosure, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+  drawEnclosedCartesianCurve(ctx, rect, tStart, tEnd, tStep, middleColumn, lastColumn, firstSampledColumn, yEnclosure, xyFloatEvaluation, model, context, color, thick, xyDoubleEvaluation);
+}
+
+void CurveView::drawSampledColumns(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, int lastColumn, int * firstSampledColumn, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+  if (*firstSampledColumn < 0) {
+    return;
+  }
+  float t = tStart + *firstSampledColumn * tStep;
+  float s = std::min(tStart + lastColumn * tStep, tEnd);
+  *firstSampledColumn = -1;
+  drawCurve(ctx, rect, t, s, tStep, xyFloatEvaluation, model, context, true, color, thick, false, 0.0f, 0.0f, xyDoubleEvaluation);
+}
+
+void CurveView::drawAroundAsymptote(KDContext * ctx, KDRect rect, float t, float s, EncloseYForXRange yEnclosure, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+  Enclosure enclosure = yEnclosure(t, s, model, context);
+  if (enclosure.status() == Enclosure::Status::Undefined || !enclosureIsVisible(rect, enclosure, thick)) {
+    return;
+  }
+  if (enclosure.isBounded()) {
+    drawCurve(ctx, rect, t, s, s - t, xyFloatEvaluation, model, context, true, color, thick, false, 0.0f, 0.0f, xyDoubleEvaluation);
+    return;
+  }
+  float middle = (t + s) / 2.0f;
+  if (maxNumberOfRecursion <= 0 || middle <= t || s <= middle) {
+    // The curve is not drawn on the range containing the asymptote
+    return;
+  }
+  drawAroundAsymptote(ctx, rect, t, middle, yEnclosure, xyFloatEvaluation, model, context, color, thick, maxNumberOfRecursion - 1, xyDoubleEvaluation);
+  drawAroundAsymptote(ctx, rect, middle, s, yEnclosure, xyFloatEvaluation, model, context, color, thick, maxNumberOfRecursion - 1, xyDoubleEvaluation);
+}
+
+bool CurveView::enclosureIsVisible(KDRect rect, Enclosure enclosure, bool thick) const {
+  /* The pixel ordinates decrease when the values increase: the enclosure is
+   * drawn between the pixels of its max and its min. */
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+  return floatToPixel(Axis::Vertical, enclosure.max()) <= rect.bottom() + stampSize
+    && floatToPixel(Axis::Vertical, enclosure.min()) >= rect.top() - stampSize;
 }
 
 float PolarThetaFromCoordinates(float x, float y, Preferences::AngleUnit angleUnit) {
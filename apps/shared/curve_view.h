@@ -7,6 +7,7 @@
 #include "cursor_view.h"
 #include <poincare/preferences.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/enclosure.h>
 #include <cmath>
 
 namespace Shared {
@@ -19,6 +20,7 @@ public:
   typedef Poincare::Coordinate2D<float> (*EvaluateXYForFloatParameter)(float t, void * model, void * context);
   typedef Poincare::Coordinate2D<double> (*EvaluateXYForDoubleParameter)(double t, void * model, void * context);
   typedef float (*EvaluateYForX)(float x, void * model, void * context);
+  typedef Poincare::Enclosure (*EncloseYForXRange)(double xMin, double xMax, void * model, void * context);
   enum class Axis {
     Horizontal = 0,
     Vertical = 1
@@ -109,7 +111,12 @@ protected:
   void drawAxes(KDContext * ctx, KDRect rect) const;
   void drawAxis(KDContext * ctx, KDRect rect, Axis axis) const;
   void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
-  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
+  /* If yEnclosure is provided, the enclosures of the curve on ranges of
+   * columns guide the drawing: the ranges where the curve is undefined or out
+   * of rect are skipped, the flat ones are drawn in one segment and the
+   * curve is never joined across a range where it may be unbounded. The other
+   * columns are sampled as by drawCurve. */
+  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr, EncloseYForXRange yEnclosure = nullptr) const;
   void drawPolarCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
     bool fillBar, KDColor defaultColor, KDColor highlightColor,  float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
@@ -141,12 +148,25 @@ private:
   /* Recursively join two dots (dichotomy). The method stops when the
    * maxNumberOfRecursion in reached. */
   void joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
+  /* Draw the columns [firstColumn, lastColumn[ of a cartesian curve, starting
+   * at tStart, by dichotomy on their enclosure. The columns left to sample
+   * are gathered from *firstSampledColumn, and sampled with drawCurve once a
+   * column is drawn otherwise. */
+  void drawEnclosedCartesianCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, int firstColumn, int lastColumn, int * firstSampledColumn, EncloseYForXRange yEnclosure, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, EvaluateXYForDoubleParameter xyDoubleEvaluation) const;
+  void drawSampledColumns(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, int lastColumn, int * firstSampledColumn, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, EvaluateXYForDoubleParameter xyDoubleEvaluation) const;
+  /* Draw the curve on [t, s], where it may be unbounded, without joining the
+   * dots across the ranges where it is unbounded, down to the
+   * maxNumberOfRecursion-th subdivision. */
+  void drawAroundAsymptote(KDContext * ctx, KDRect rect, float t, float s, EncloseYForXRange yEnclosure, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation) const;
+  // Whether the enclosed part of the curve can be visible in rect
+  bool enclosureIsVisible(KDRect rect, Poincare::Enclosure enclosure, bool thick) const;
   /* Join two dots with a straight line. */
   void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color, bool thick) const;
   /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
    * function shifts the stamp (by blending adjacent pixel colors) to draw with
    * anti alising. */
   void stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const;
+  bool drawsThroughTile() const override { return true; }
   void layoutSubviews(bool force = false) override;
   KDRect cursorFrame();
   KDRect bannerFrame();
@@ -0,0 +1,70 @@
+#include "decoded_expression_cache.h"
+#include <ion/storage.h>
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+bool DecodedExpressionCache::find(const char * name, Kind * kind, Expression * expression) {
+  checkGeneration();
+  char * tree = reinterpret_cast<char *>(m_buffer);
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    if (strcmp(m_entries[i].name, name) == 0) {
+      m_numberOfHits++;
+      *kind = m_entries[i].kind;
+      *expression = Expression::ExpressionFromTreeAddress(tree, m_entries[i].size);
+      return true;
+    }
+    tree += m_entries[i].size;
+  }
+  m_numberOfMisses++;
+  return false;
+}
+
+void DecodedExpressionCache::store(const char * name, Kind kind, const Expression expression) {
+  checkGeneration();
+  size_t size = expression.isUninitialized() ? 0 : expression.size();
+  if (size > k_bufferSize || strlen(name) >= Poincare::SymbolAbstract::k_maxNameSize) {
+    return;
+  }
+  while (m_numberOfEntries == k_maxNumberOfEntries || bufferSize() + size > k_bufferSize) {
+    removeOldestEntry();
+  }
+  Entry * entry = m_entries + m_numberOfEntries;
+  strlcpy(entry->name, name, sizeof(entry->name));
+  entry->kind = kind;
+  entry->size = size;
+  if (size > 0) {
+    memcpy(reinterpret_cast<char *>(m_buffer) + bufferSize(), expression.addressInPool(), size);
+  }
+  m_numberOfEntries++;
+}
+
+void DecodedExpressionCache::checkGeneration() {
+  uint32_t generation = Ion::Storage::sharedStorage()->generation();
+  if (generation != m_generation) {
+    clear();
+    m_generation = generation;
+  }
+}
+
+void DecodedExpressionCache::removeOldestEntry() {
+  assert(m_numberOfEntries > 0);
+  size_t size = m_entries[0].size;
+  char * buffer = reinterpret_cast<char *>(m_buffer);
+  memmove(buffer, buffer + size, bufferSize() - size);
+  memmove(m_entries, m_entries + 1, (m_numberOfEntries - 1) * sizeof(Entry));
+  m_numberOfEntries--;
+}
+
+int DecodedExpressionCache::bufferSize() const {
+  int size = 0;
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    size += m_entries[i].size;
+  }
+  return size;
+}
+
+}
@@ -0,0 +1,70 @@
+#ifndef SHARED_DECODED_EXPRESSION_CACHE_H
+#define SHARED_DECODED_EXPRESSION_CACHE_H
+
+#include <poincare/expression.h>
+#include <poincare/symbol_abstract.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* The global context looks the symbols up in the storage, and decodes the
+ * expression of their record, at each evaluation. This cache keeps the trees
+ * of the last symbols looked up, as they are in the pool: a lookup then only
+ * copies the tree back into the pool.
+ * The trees are stored one after the other in a single buffer, the oldest
+ * ones being evicted when it is full. The cache is emptied when the storage
+ * changes. */
+
+class DecodedExpressionCache {
+public:
+  enum class Kind : uint8_t {
+    None, // No record has this name
+    Symbol,
+    Function,
+    Sequence
+  };
+
+  DecodedExpressionCache() :
+    m_generation(0),
+    m_numberOfEntries(0),
+    m_numberOfHits(0),
+    m_numberOfMisses(0)
+  {}
+
+  /* Returns false if name is not cached. Otherwise, sets the kind of its
+   * record and a copy of the tree of its expression, with UCodePointUnknown
+   * as the variable of functions. */
+  bool find(const char * name, Kind * kind, Poincare::Expression * expression);
+  void store(const char * name, Kind kind, const Poincare::Expression expression);
+  void clear() { m_numberOfEntries = 0; }
+
+  int numberOfEntries() const { return m_numberOfEntries; }
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+
+  constexpr static int k_maxNumberOfEntries = 8;
+  constexpr static int k_bufferSize = 1024;
+private:
+  struct Entry {
+    char name[Poincare::SymbolAbstract::k_maxNameSize];
+    Kind kind;
+    uint16_t size;
+  };
+
+  // Empties the cache if the storage changed since the last lookup
+  void checkGeneration();
+  void removeOldestEntry();
+  int bufferSize() const;
+
+  uint32_t m_generation;
+  Entry m_entries[k_maxNumberOfEntries];
+  int m_numberOfEntries;
+  int m_numberOfHits;
+  int m_numberOfMisses;
+  // The trees are word-aligned in the pool
+  uint32_t m_buffer[k_bufferSize / sizeof(uint32_t)];
+};
+
+}
+
+#endif
@@ -50,6 +50,7 @@ KDColor Function::color() const {
 
 void Function::setActive(bool active) {
   recordData()->setActive(active);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
   if (!active) {
     didBecomeInactive();
   }
@@ -57,6 +58,7 @@ void Function::setActive(bool active) {
 
 void Function::setColor(KDColor color) {
   recordData()->setColor(color);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
 }
 
 int Function::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
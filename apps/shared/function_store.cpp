@@ -1,4 +1,5 @@
 #include "function_store.h"
+#include <ion.h>
 
 namespace Shared {
 
@@ -6,4 +7,39 @@ uint32_t FunctionStore::storeChecksum() {
   return Ion::Storage::sharedStorage()->checksum();
 }
 
+bool FunctionStore::memoizedInterestingRanges(float targetRatio, float * xMin, float * xMax, float * yMin, float * yMax) {
+  if (!hasMemoizedInterestingRanges(targetRatio)) {
+    return false;
+  }
+  *xMin = m_interestingRanges[0];
+  *xMax = m_interestingRanges[1];
+  *yMin = m_interestingRanges[2];
+  *yMax = m_interestingRanges[3];
+  return true;
+}
+
+void FunctionStore::memoizeInterestingRanges(float targetRatio, float xMin, float xMax, float yMin, float yMax) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  m_interestingRangesGeneration = Ion::Storage::sharedStorage()->generation();
+  m_interestingRangesAngleUnit = preferences->angleUnit();
+  m_interestingRangesComplexFormat = preferences->complexFormat();
+  m_interestingRangesRatio = targetRatio;
+  m_interestingRanges[0] = xMin;
+  m_interestingRanges[1] = xMax;
+  m_interestingRanges[2] = yMin;
+  m_interestingRanges[3] = yMax;
+  m_hasMemoizedInterestingRanges = true;
+}
+
+bool FunctionStore::hasMemoizedInterestingRanges(float targetRatio) const {
+  /* The functions are evaluated with the angle unit and the complex format of
+   * the preferences, which are not part of the storage. */
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  return m_hasMemoizedInterestingRanges
+    && m_interestingRangesGeneration == Ion::Storage::sharedStorage()->generation()
+    && m_interestingRangesAngleUnit == preferences->angleUnit()
+    && m_interestingRangesComplexFormat == preferences->complexFormat()
+    && m_interestingRangesRatio == targetRatio;
+}
+
 }
@@ -3,6 +3,7 @@
 
 #include "function.h"
 #include "expression_model_store.h"
+#include <poincare/preferences.h>
 #include <stdint.h>
 
 namespace Shared {
@@ -11,7 +12,7 @@ namespace Shared {
 
 class FunctionStore : public ExpressionModelStore {
 public:
-  FunctionStore() : ExpressionModelStore() {}
+  FunctionStore() : ExpressionModelStore(), m_hasMemoizedInterestingRanges(false) {}
   uint32_t storeChecksum();
   int numberOfActiveFunctions() const {
     return numberOfModelsSatisfyingTest(&isFunctionActive, nullptr);
@@ -20,11 +21,26 @@ public:
     return recordSatisfyingTestAtIndex(i, &isFunctionActive, nullptr);
   }
   ExpiringPointer<Function> modelForRecord(Ion::Storage::Record record) const { return ExpiringPointer<Function>(static_cast<Function *>(privateModelForRecord(record))); }
+  /* Computing the interesting ranges samples each active function several
+   * hundred times. The result is kept for as long as the generation of the
+   * storage, the preferences and the target ratio are unchanged, so that going
+   * back to the graph or pressing "Auto" does not sample the functions again. */
+  bool memoizedInterestingRanges(float targetRatio, float * xMin, float * xMax, float * yMin, float * yMax);
+  void memoizeInterestingRanges(float targetRatio, float xMin, float xMax, float yMin, float yMax);
 protected:
   static bool isFunctionActive(ExpressionModelHandle * model, void * context) {
     // An active function must be defined
     return isModelDefined(model, context) && static_cast<Function *>(model)->isActive();
   }
+private:
+  bool hasMemoizedInterestingRanges(float targetRatio) const;
+
+  uint32_t m_interestingRangesGeneration;
+  Poincare::Preferences::AngleUnit m_interestingRangesAngleUnit;
+  Poincare::Preferences::ComplexFormat m_interestingRangesComplexFormat;
+  float m_interestingRangesRatio;
+  float m_interestingRanges[4];
+  bool m_hasMemoizedInterestingRanges;
 };
 
 }
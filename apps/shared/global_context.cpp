@@ -57,8 +57,31 @@ Context::SymbolAbstractType GlobalContext::expressionTypeForIdentifier(const cha
 }
 
 const Expression GlobalContext::expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue ) {
-  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
-  return ExpressionForSymbolAndRecord(symbol, r, this, unknownSymbolValue);
+  if (symbol.type() == ExpressionNode::Type::Sequence) {
+    // The value of a sequence depends on its rank and is not cached
+    Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+    return ExpressionForSequence(symbol, r, this, unknownSymbolValue);
+  }
+  DecodedExpressionCache::Kind kind;
+  Expression e;
+  if (!m_expressionCache.find(symbol.name(), &kind, &e)) {
+    Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+    kind = KindOfRecord(r);
+    if (kind == DecodedExpressionCache::Kind::Symbol) {
+      e = ExpressionForActualSymbol(r);
+    } else if (kind == DecodedExpressionCache::Kind::Function) {
+      e = ContinuousFunction(r).expressionClone();
+    }
+    m_expressionCache.store(symbol.name(), kind, e);
+  }
+  if (symbol.type() == ExpressionNode::Type::Symbol) {
+    return kind == DecodedExpressionCache::Kind::Symbol ? e : Expression();
+  }
+  assert(symbol.type() == ExpressionNode::Type::Function);
+  if (kind != DecodedExpressionCache::Kind::Function || e.isUninitialized()) {
+    return Expression();
+  }
+  return e.replaceSymbolWithExpression(Symbol::Builder(UCodePointUnknown), symbol.childAtIndex(0));
 }
 
 void GlobalContext::setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) {
@@ -70,6 +93,7 @@ void GlobalContext::setExpressionForSymbolAbstract(const Expression & expression
     e = Undefined::Builder();
   }
   Expression finalExpression = expression.clone().replaceSymbolWithExpression(symbol, e);
+  m_expressionCache.clear();
 
   // Set the expression in the storage depending on the symbol type
   if (symbol.type() == ExpressionNode::Type::Symbol) {
@@ -186,4 +210,16 @@ Ion::Storage::Record GlobalContext::SymbolAbstractRecordWithBaseName(const char
   return Ion::Storage::sharedStorage()->recordBaseNamedWithExtensions(name, k_extensions, k_numberOfExtensions);
 }
 
+DecodedExpressionCache::Kind GlobalContext::KindOfRecord(Ion::Storage::Record r) {
+  if (r.isNull()) {
+    return DecodedExpressionCache::Kind::None;
+  } else if (Ion::Storage::FullNameHasExtension(r.fullName(), Ion::Storage::expExtension, strlen(Ion::Storage::expExtension))) {
+    return DecodedExpressionCache::Kind::Symbol;
+  } else if (Ion::Storage::FullNameHasExtension(r.fullName(), Ion::Storage::funcExtension, strlen(Ion::Storage::funcExtension))) {
+    return DecodedExpressionCache::Kind::Function;
+  }
+  assert(Ion::Storage::FullNameHasExtension(r.fullName(), Ion::Storage::seqExtension, strlen(Ion::Storage::seqExtension)));
+  return DecodedExpressionCache::Kind::Sequence;
+}
+
 }
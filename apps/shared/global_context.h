@@ -8,6 +8,7 @@
 #include <poincare/symbol.h>
 #include <ion/storage.h>
 #include <assert.h>
+#include "decoded_expression_cache.h"
 #include "sequence_store.h"
 
 namespace Shared {
@@ -32,6 +33,7 @@ public:
   const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) override;
   void setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override;
   static SequenceStore * sequenceStore();
+  const DecodedExpressionCache * expressionCache() const { return &m_expressionCache; }
 private:
   // Expression getters
   static const Poincare::Expression ExpressionForSymbolAndRecord(const Poincare::SymbolAbstract & symbol, Ion::Storage::Record r, Context * ctx, float unknownSymbolValue = NAN);
@@ -43,7 +45,9 @@ private:
   static Ion::Storage::Record::ErrorStatus SetExpressionForFunction(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol, Ion::Storage::Record previousRecord);
   // Record getter
   static Ion::Storage::Record SymbolAbstractRecordWithBaseName(const char * name);
+  static DecodedExpressionCache::Kind KindOfRecord(Ion::Storage::Record r);
 
+  DecodedExpressionCache m_expressionCache;
 };
 
 }
@@ -6,6 +6,19 @@
 namespace Shared {
 
 void InteractiveCurveViewRangeDelegate::DefaultInterestingRanges(InteractiveCurveViewRange * range, Poincare::Context * context, FunctionStore * functionStore, float targetRatio) {
+  float xMin, xMax, yMin, yMax;
+  if (!functionStore->memoizedInterestingRanges(targetRatio, &xMin, &xMax, &yMin, &yMax)) {
+    ComputeInterestingRanges(context, functionStore, targetRatio, &xMin, &xMax, &yMin, &yMax);
+    functionStore->memoizeInterestingRanges(targetRatio, xMin, xMax, yMin, yMax);
+  }
+
+  range->setXMin(xMin);
+  range->setXMax(xMax);
+  range->setYMin(yMin);
+  range->setYMax(yMax);
+}
+
+void InteractiveCurveViewRangeDelegate::ComputeInterestingRanges(Poincare::Context * context, FunctionStore * functionStore, float targetRatio, float * xMin, float * xMax, float * yMin, float * yMax) {
   constexpr int maxLength = 10;
   float xMins[maxLength], xMaxs[maxLength], yMins[maxLength], yMaxs[maxLength];
   int length = functionStore->numberOfActiveFunctions();
@@ -15,15 +28,9 @@ void InteractiveCurveViewRangeDelegate::DefaultInterestingRanges(InteractiveCurv
     f->rangeForDisplay(xMins + i, xMaxs + i, yMins + i, yMaxs + i, targetRatio, context);
   }
 
-  float xMin, xMax, yMin, yMax;
-  Poincare::Zoom::CombineRanges(length, xMins, xMaxs, &xMin, &xMax);
-  Poincare::Zoom::CombineRanges(length, yMins, yMaxs, &yMin, &yMax);
-  Poincare::Zoom::SanitizeRange(&xMin, &xMax, &yMin, &yMax, range->NormalYXRatio());
-
-  range->setXMin(xMin);
-  range->setXMax(xMax);
-  range->setYMin(yMin);
-  range->setYMax(yMax);
+  Poincare::Zoom::CombineRanges(length, xMins, xMaxs, xMin, xMax);
+  Poincare::Zoom::CombineRanges(length, yMins, yMaxs, yMin, yMax);
+  Poincare::Zoom::SanitizeRange(xMin, xMax, yMin, yMax, InteractiveCurveViewRange::NormalYXRatio());
 }
 
 float InteractiveCurveViewRangeDelegate::DefaultAddMargin(float x, float range, bool isVertical, bool isMin, float top, float bottom, float left, float right) {
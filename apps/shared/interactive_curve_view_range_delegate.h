@@ -21,6 +21,8 @@ public:
   virtual void interestingRanges(InteractiveCurveViewRange * range) { assert(false); }
   virtual float addMargin(float x, float range, bool isVertical, bool isMin) = 0;
   virtual void updateZoomButtons() = 0;
+private:
+  static void ComputeInterestingRanges(Poincare::Context * context, FunctionStore * functionStore, float targetRatio, float * xMin, float * xMax, float * yMin, float * yMax);
 };
 
 }
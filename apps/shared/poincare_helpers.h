@@ -106,6 +106,12 @@ inline double NextRoot(const Poincare::Expression e, const char * symbol, double
   return e.nextRoot(symbol, start, step, max, context, complexFormat, preferences->angleUnit());
 }
 
+inline int Roots(const Poincare::Expression e, const char * symbol, double start, double step, double max, double * roots, int maxNumberOfRoots, Poincare::Context * context) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  return e.roots(symbol, start, step, max, roots, maxNumberOfRoots, context, complexFormat, preferences->angleUnit());
+}
+
 inline typename Poincare::Coordinate2D<double> NextIntersection(const Poincare::Expression e, const char * symbol, double start, double step, double max, Poincare::Context * context, const Poincare::Expression expression) {
   Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
   Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
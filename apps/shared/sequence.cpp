@@ -71,6 +71,7 @@ void Sequence::setType(Type t) {
     setInitialRank(0);
   }
   recordData()->setType(t);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
   m_definition.tidyName();
   tidy();
   /* Reset all contents */
@@ -101,6 +102,7 @@ void Sequence::setType(Type t) {
 
 void Sequence::setInitialRank(int rank) {
   recordData()->setInitialRank(rank);
+  Ion::Storage::sharedStorage()->recordValueDidChangeInPlace();
   m_firstInitialCondition.tidyName();
   m_secondInitialCondition.tidyName();
 }
@@ -13,6 +13,7 @@ class SimpleInteractiveCurveViewController : public ZoomCurveViewController, pub
 public:
   SimpleInteractiveCurveViewController(Responder * parentResponder, CurveViewCursor * cursor) : ZoomCurveViewController(parentResponder), m_cursor(cursor) {}
   bool handleEvent(Ion::Events::Event event) override;
+  bool allowsEventCoalescing() const override { return true; }
   bool textFieldDidReceiveEvent(TextField * textField, Ion::Events::Event event) override;
 protected:
   virtual float cursorRightMarginRatio() { return 0.04f; } // (cursorWidth/2)/(graphViewWidth-1)
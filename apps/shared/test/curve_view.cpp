@@ -0,0 +1,151 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <kandinsky.h>
+#include <poincare/enclosure.h>
+#include <stdio.h>
+#include "../curve_view.h"
+#include "../global_context.h"
+#include "../../../poincare/test/helper.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+class FixedCurveViewRange : public CurveViewRange {
+public:
+  FixedCurveViewRange(float xMin, float xMax, float yMin, float yMax) :
+    m_xMin(xMin), m_xMax(xMax), m_yMin(yMin), m_yMax(yMax)
+  {}
+  float xMin() const override { return m_xMin; }
+  float xMax() const override { return m_xMax; }
+  float yMin() const override { return m_yMin; }
+  float yMax() const override { return m_yMax; }
+private:
+  float m_xMin;
+  float m_xMax;
+  float m_yMin;
+  float m_yMax;
+};
+
+// Counts the evaluations needed to draw the curve of y=expression(x)
+class CountingCurve {
+public:
+  CountingCurve(Expression expression, Context * context) :
+    m_expression(expression),
+    m_context(context),
+    m_numberOfSamples(0),
+    m_numberOfEnclosures(0)
+  {}
+  int numberOfSamples() const { return m_numberOfSamples; }
+  int numberOfEnclosures() const { return m_numberOfEnclosures; }
+
+  static Coordinate2D<float> EvaluateFloat(float t, void * model, void * context) {
+    CountingCurve * curve = static_cast<CountingCurve *>(model);
+    curve->m_numberOfSamples++;
+    return Coordinate2D<float>(t, curve->m_expression.approximateWithValueForSymbol<float>("x", t, curve->m_context, Real, Radian));
+  }
+  static Coordinate2D<double> EvaluateDouble(double t, void * model, void * context) {
+    CountingCurve * curve = static_cast<CountingCurve *>(model);
+    curve->m_numberOfSamples++;
+    return Coordinate2D<double>(t, curve->m_expression.approximateWithValueForSymbol<double>("x", t, curve->m_context, Real, Radian));
+  }
+  static Enclosure Enclose(double tStart, double tEnd, void * model, void * context) {
+    CountingCurve * curve = static_cast<CountingCurve *>(model);
+    curve->m_numberOfEnclosures++;
+    return Enclosure::ForExpression(curve->m_expression, "x", tStart, tEnd, Radian);
+  }
+
+private:
+  Expression m_expression;
+  Context * m_context;
+  int m_numberOfSamples;
+  int m_numberOfEnclosures;
+};
+
+class CartesianCurveView : public CurveView {
+public:
+  constexpr static KDCoordinate k_width = 160;
+  constexpr static KDCoordinate k_height = 120;
+  CartesianCurveView(CurveViewRange * range) : CurveView(range) {
+    setFrame(KDRect(0, 0, k_width, k_height), false);
+  }
+  void drawCurve(KDContext * ctx, CountingCurve * curve, bool enclose) const {
+    drawCartesianCurve(ctx, bounds(), -INFINITY, INFINITY, CountingCurve::EvaluateFloat, curve, nullptr, KDColorBlack, true, false, 0.0f, 0.0f, CountingCurve::EvaluateDouble, enclose ? CountingCurve::Enclose : nullptr);
+  }
+};
+
+constexpr static int k_numberOfPixels = CartesianCurveView::k_width * CartesianCurveView::k_height;
+
+static bool is_inked(const KDColor * pixels, int x, int y, uint8_t threshold) {
+  return x >= 0 && y >= 0 && x < CartesianCurveView::k_width && y < CartesianCurveView::k_height
+    && pixels[x + y * CartesianCurveView::k_width].red() < threshold;
+}
+
+/* Count the pixels well inked on a drawing, that have no inked neighbour on
+ * the other drawing. */
+static int number_of_unmatched_pixels(const KDColor * drawing, const KDColor * otherDrawing) {
+  int result = 0;
+  for (int y = 0; y < CartesianCurveView::k_height; y++) {
+    for (int x = 0; x < CartesianCurveView::k_width; x++) {
+      if (!is_inked(drawing, x, y, 0x40)) {
+        continue;
+      }
+      bool matched = false;
+      for (int dy = -1; dy <= 1 && !matched; dy++) {
+        for (int dx = -1; dx <= 1 && !matched; dx++) {
+          matched = is_inked(otherDrawing, x + dx, y + dy, 0xC0);
+        }
+      }
+      result += !matched;
+    }
+  }
+  return result;
+}
+
+static KDColor s_sampledDrawing[k_numberOfPixels];
+static KDColor s_enclosedDrawing[k_numberOfPixels];
+
+/* Draw the curve with and without its enclosures, and compare the number of
+ * evaluations and the drawings. */
+static void assert_enclosures_draw_curve(const char * definition, int * numberOfSamples, int * numberOfEnclosedSamples) {
+  GlobalContext context;
+  Expression e = Expression::ParseAndSimplify(definition, &context, Real, Radian, Metric);
+  FixedCurveViewRange range(-5.0f, 5.0f, -3.0f, 3.0f);
+  CartesianCurveView view(&range);
+  KDColor * drawings[] = {s_sampledDrawing, s_enclosedDrawing};
+  CountingCurve sampledCurve(e, &context);
+  CountingCurve enclosedCurve(e, &context);
+  CountingCurve * curves[] = {&sampledCurve, &enclosedCurve};
+  for (int i = 0; i < 2; i++) {
+    KDFrameBuffer frameBuffer(drawings[i], KDSize(CartesianCurveView::k_width, CartesianCurveView::k_height));
+    KDFrameBufferContext ctx(&frameBuffer);
+    ctx.fillRect(view.bounds(), KDColorWhite);
+    view.drawCurve(&ctx, curves[i], i == 1);
+  }
+  int numberOfMissedPixels = number_of_unmatched_pixels(s_sampledDrawing, s_enclosedDrawing);
+  int numberOfExtraPixels = number_of_unmatched_pixels(s_enclosedDrawing, s_sampledDrawing);
+  char buffer[128];
+  snprintf(buffer, sizeof(buffer), "%s: %d samples, %d with %d enclosures, %d/%d pixels apart", definition, sampledCurve.numberOfSamples(), enclosedCurve.numberOfSamples(), enclosedCurve.numberOfEnclosures(), numberOfMissedPixels, numberOfExtraPixels);
+  quiz_print(buffer);
+  quiz_assert_print_if_failure(numberOfMissedPixels == 0 && numberOfExtraPixels == 0, definition);
+  quiz_assert_print_if_failure(enclosedCurve.numberOfSamples() <= sampledCurve.numberOfSamples(), definition);
+  *numberOfSamples += sampledCurve.numberOfSamples();
+  *numberOfEnclosedSamples += enclosedCurve.numberOfSamples();
+}
+
+QUIZ_CASE(curve_view_enclosed_cartesian_curve) {
+  const char * definitions[] = {
+    "x^3-x", "3", "0.01×x+1", "ℯ^(-x^2)", "sin(10×x)", "1/x", "1/(x^2-1)",
+    "tan(x)", "√(x)", "ln(x)", "x×sin(1/x)", "√(-x^2-1)", "100x^2", "floor(x)"
+  };
+  int numberOfSamples = 0;
+  int numberOfEnclosedSamples = 0;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (const char * definition : definitions) {
+    assert_enclosures_draw_curve(definition, &numberOfSamples, &numberOfEnclosedSamples);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(numberOfEnclosedSamples < numberOfSamples);
+}
+
+}
@@ -0,0 +1,102 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <poincare/function.h>
+#include <poincare/symbol.h>
+#include <stdio.h>
+#include <cmath>
+#include "../global_context.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+void set_symbol(const char * name, const char * text, GlobalContext * context) {
+  Symbol symbol = Symbol::Builder(name, strlen(name));
+  context->setExpressionForSymbolAbstract(Expression::Parse(text, context), symbol);
+}
+
+void set_function(const char * name, const char * text, GlobalContext * context) {
+  Poincare::Function function = Poincare::Function::Builder(name, strlen(name), Symbol::Builder('x'));
+  context->setExpressionForSymbolAbstract(Expression::Parse(text, context), function);
+}
+
+double approximate(const char * text, GlobalContext * context) {
+  Expression e = Expression::Parse(text, context);
+  return e.approximateToScalar<double>(context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+}
+
+QUIZ_CASE(global_context_expression_cache) {
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+  GlobalContext context;
+  const DecodedExpressionCache * cache = context.expressionCache();
+  set_symbol("a", "3", &context);
+  set_function("f", "x^2+a", &context);
+
+  quiz_assert(approximate("f(2)+a", &context) == 10.0);
+  int misses = cache->numberOfMisses();
+  int hits = cache->numberOfHits();
+  quiz_assert(approximate("f(2)+a", &context) == 10.0);
+  quiz_assert(cache->numberOfMisses() == misses && cache->numberOfHits() > hits);
+
+  // Undefined symbols are cached too
+  quiz_assert(std::isnan(approximate("b", &context)));
+  misses = cache->numberOfMisses();
+  quiz_assert(std::isnan(approximate("b", &context)));
+  quiz_assert(cache->numberOfMisses() == misses);
+
+  // Setting a symbol invalidates the cache
+  set_symbol("a", "5", &context);
+  quiz_assert(cache->numberOfEntries() == 0);
+  quiz_assert(approximate("f(2)+a", &context) == 14.0);
+
+  // So does any change of the storage
+  Ion::Storage::sharedStorage()->recordNamed("a.exp").destroy();
+  quiz_assert(std::isnan(approximate("a", &context)));
+  set_symbol("b", "7", &context);
+  quiz_assert(approximate("b", &context) == 7.0);
+
+  // Past its capacity, the oldest symbols are evicted
+  char name[] = "c0";
+  for (int i = 0; i < 10; i++) {
+    name[1] = '0' + i;
+    set_symbol(name, name + 1, &context);
+  }
+  for (int i = 0; i < 10; i++) {
+    name[1] = '0' + i;
+    quiz_assert(approximate(name, &context) == i);
+  }
+  quiz_assert(cache->numberOfEntries() == DecodedExpressionCache::k_maxNumberOfEntries);
+  for (int i = 0; i < 10; i++) {
+    name[1] = '0' + i;
+    quiz_assert(approximate(name, &context) == i);
+  }
+
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+}
+
+QUIZ_CASE(global_context_expression_cache_benchmark) {
+  /* Approximate an expression using two functions and a variable, among
+   * thirty records, as when plotting a function defined with them. */
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+  GlobalContext context;
+  char name[] = "v00";
+  for (int i = 0; i < 30; i++) {
+    name[1] = '0' + i / 10;
+    name[2] = '0' + i % 10;
+    set_symbol(name, "1", &context);
+  }
+  set_symbol("a", "2", &context);
+  set_function("f", "a×x^2+1", &context);
+  set_function("g", "f(x)-x", &context);
+  Expression e = Expression::Parse("g(x)+a", &context);
+  uint64_t startTime = quiz_stopwatch_start();
+  double sum = 0.0;
+  for (int i = 0; i < 1000; i++) {
+    sum += e.approximateWithValueForSymbol<double>("x", i / 1000.0, &context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(!std::isnan(sum) && sum > 0.0);
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+}
+
+}
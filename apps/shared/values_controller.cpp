@@ -2,7 +2,6 @@
 #include "function_app.h"
 #include <poincare/preferences.h>
 #include <assert.h>
-#include <limits.h>
 #include <algorithm>
 
 using namespace Poincare;
@@ -10,9 +9,7 @@ using namespace Poincare;
 namespace Shared {
 
 constexpr int ValuesController::k_maxNumberOfDisplayableRows;
-
-// TODO: use std::abs
-static inline int absInt(int x) { return x < 0 ? -x : x; }
+constexpr int ValuesController::k_valuesCellBufferSize;
 
 // Constructor and helpers
 
@@ -21,8 +18,9 @@ ValuesController::ValuesController(Responder * parentResponder, ButtonRowControl
   ButtonRowDelegate(header, nullptr),
   m_numberOfColumns(0),
   m_numberOfColumnsNeedUpdate(true),
-  m_firstMemoizedColumn(INT_MAX),
-  m_firstMemoizedRow(INT_MAX),
+  m_prefetchTimer(this),
+  m_lastPrefetchSelectedRow(-1),
+  m_prefetchDirection(1),
   m_abscissaParameterController(this)
 {
 }
@@ -57,9 +55,11 @@ void ValuesController::viewWillAppear() {
   resetMemoization();
   EditableCellTableViewController::viewWillAppear();
   header()->setSelectedButton(-1);
+  m_prefetchTimer.start();
 }
 
 void ValuesController::viewDidDisappear() {
+  m_prefetchTimer.stop();
   m_numberOfColumnsNeedUpdate = true;
   EditableCellTableViewController::viewDidDisappear();
 }
@@ -157,8 +157,12 @@ void ValuesController::willDisplayCellAtLocation(HighlightCell * cell, int i, in
     if (j == numberOfElementsInColumn(i) + 1) {
       static_cast<EvenOddBufferTextCell *>(cell)->setText("");
     } else {
-      static_cast<EvenOddBufferTextCell *>(cell)->setText(memoizedBufferForCell(i, j));
+      char buffer[k_valuesCellBufferSize];
+      printEvaluation(buffer, k_valuesCellBufferSize, memoizedValueForCell(i, j), i);
+      static_cast<EvenOddBufferTextCell *>(cell)->setText(buffer);
     }
+    // The table may have scrolled: the rows ahead may not be memoized
+    m_prefetchTimer.start();
   }
 }
 
@@ -237,15 +241,11 @@ double ValuesController::dataAtLocation(int columnIndex, int rowIndex) {
 }
 
 void ValuesController::didChangeCell(int column, int row) {
-  /* Update the row memoization if it exists */
+  /* Forget the memoized evaluations of the row */
   // the first row is never reloaded as it corresponds to title row
   assert(row > 0);
   // Conversion of coordinates from absolute table to values table
-  int memoizedRow = valuesRowForAbsoluteRow(row) - m_firstMemoizedRow;
-  if (0 > memoizedRow || memoizedRow >= k_maxNumberOfDisplayableRows) {
-    // The changed row is out of the memoized table
-    return;
-  }
+  int valuesRow = valuesRowForAbsoluteRow(row);
 
   // Find the abscissa column corresponding to column
   int abscissaColumn = 0;
@@ -255,16 +255,10 @@ void ValuesController::didChangeCell(int column, int row) {
     nbOfColumns += numberOfColumnsForAbscissaColumn(abscissaColumn);
   }
 
-  // Update the memoization of rows linked to the changed cell
-  int nbOfMemoizedColumns = numberOfMemoizedColumn();
+  // Forget the memoization of rows linked to the changed cell
   int nbOfColumnsForAbscissa = numberOfColumnsForAbscissaColumn(abscissaColumn);
   for (int i = abscissaColumn+1; i < abscissaColumn+nbOfColumnsForAbscissa; i++) {
-    int memoizedI = valuesColumnForAbsoluteColumn(i) - m_firstMemoizedColumn;
-    if (memoizedI < 0 || memoizedI >= nbOfMemoizedColumns) {
-      // The changed column is out of the memoized table
-      continue;
-    }
-    fillMemoizedBuffer(i, row, nbOfMemoizedColumns*memoizedRow+memoizedI);
+    memoization()->forgetCell(valuesColumnForAbsoluteColumn(i), valuesRow);
   }
 }
 
@@ -301,60 +295,61 @@ FunctionStore * ValuesController::functionStore() const {
 
 // Function evaluation memoization
 
-void ValuesController::resetMemoization() {
-  m_firstMemoizedColumn = INT_MAX;
-  m_firstMemoizedRow = INT_MAX;
+Coordinate2D<double> ValuesController::memoizedValueForCell(int i, int j) {
+  // Conversion of coordinates from absolute table to values table
+  return memoization()->valueAtCell(valuesColumnForAbsoluteColumn(i), valuesRowForAbsoluteRow(j), EvaluateValuesCell, this);
+}
+
+Coordinate2D<double> ValuesController::EvaluateValuesCell(int column, int row, void * controller) {
+  ValuesController * valuesController = static_cast<ValuesController *>(controller);
+  // Conversion of coordinates from values table to absolute table
+  return valuesController->evaluateAtLocation(valuesController->absoluteColumnForValuesColumn(column), valuesController->absoluteRowForValuesRow(row));
 }
 
-char * ValuesController::memoizedBufferForCell(int i, int j) {
-  const int nbOfMemoizedColumns = numberOfMemoizedColumn();
-  // Conversion of coordinates from absolute table to values table
-  int valuesI = valuesColumnForAbsoluteColumn(i);
-  int valuesJ = valuesRowForAbsoluteRow(j);
-  /* Compute the required offset to apply to the memoized table in order to
-   * display cell (i,j) */
-  int offsetI = 0;
-  int offsetJ = 0;
-  if (valuesI < m_firstMemoizedColumn) {
-    offsetI = valuesI - m_firstMemoizedColumn;
-  } else if (valuesI >= m_firstMemoizedColumn + nbOfMemoizedColumns) {
-    offsetI = valuesI - nbOfMemoizedColumns - m_firstMemoizedColumn + 1;
+void ValuesController::prefetchRows() {
+  int row = selectedRow();
+  if (row <= 0) {
+    return;
   }
-  if (valuesJ < m_firstMemoizedRow) {
-    offsetJ = valuesJ - m_firstMemoizedRow;
-  } else if (valuesJ >= m_firstMemoizedRow + k_maxNumberOfDisplayableRows) {
-    offsetJ = valuesJ - k_maxNumberOfDisplayableRows - m_firstMemoizedRow + 1;
+  if (row != m_lastPrefetchSelectedRow) {
+    m_prefetchDirection = row > m_lastPrefetchSelectedRow ? 1 : -1;
+    m_lastPrefetchSelectedRow = row;
   }
-  int offset = -offsetJ*nbOfMemoizedColumns-offsetI;
-
-  // Apply the offset
-  if (offset != 0) {
-    m_firstMemoizedColumn = m_firstMemoizedColumn + offsetI;
-    m_firstMemoizedRow = m_firstMemoizedRow + offsetJ;
-    // Shift already memoized cells
-    const int numberOfMemoizedCell = k_maxNumberOfDisplayableRows * nbOfMemoizedColumns;
-    size_t moveLength = (numberOfMemoizedCell - absInt(offset))*valuesCellBufferSize()*sizeof(char);
-    if (offset > 0 && offset < numberOfMemoizedCell) {
-      memmove(memoizedBufferAtIndex(offset), memoizedBufferAtIndex(0), moveLength);
-    } else if (offset < 0 && offset > -numberOfMemoizedCell) {
-      memmove(memoizedBufferAtIndex(0), memoizedBufferAtIndex(-offset), moveLength);
-    }
-    // Compute the buffer of the new cells of the memoized table
-    int maxI = numberOfValuesColumns() - m_firstMemoizedColumn;
-    for (int ii = 0; ii < std::min(nbOfMemoizedColumns, maxI); ii++) {
-      int maxJ = numberOfElementsInColumn(absoluteColumnForValuesColumn(ii+m_firstMemoizedColumn)) - m_firstMemoizedRow;
-      for (int jj = 0; jj < std::min(k_maxNumberOfDisplayableRows, maxJ); jj++) {
-        // Escape if already filled
-        if (ii >= -offsetI && ii < -offsetI + nbOfMemoizedColumns && jj >= -offsetJ && jj < -offsetJ + k_maxNumberOfDisplayableRows) {
-          continue;
-        }
-        fillMemoizedBuffer(absoluteColumnForValuesColumn(m_firstMemoizedColumn + ii),
-            absoluteRowForValuesRow(m_firstMemoizedRow + jj),
-            jj * nbOfMemoizedColumns + ii);
+  /* Prefetch the rows following the displayed ones in the scrolling direction,
+   * for the displayed columns. */
+  SelectableTableView * table = selectableTableView();
+  int firstRow = ValuesMemoization::FirstPrefetchedRow(table->firstDisplayedRowIndex(), table->numberOfDisplayableRows(), m_prefetchDirection);
+  int firstColumn = table->firstDisplayedColumnIndex();
+  int lastColumn = std::min(firstColumn + table->numberOfDisplayableColumns(), numberOfColumns());
+  for (int i = firstColumn; i < lastColumn; i++) {
+    int lastRow = std::min(firstRow + ValuesMemoization::k_numberOfPrefetchedRows, numberOfElementsInColumn(i) + 1);
+    for (int j = std::max(firstRow, 1); j < lastRow; j++) {
+      if (typeAtLocation(i, j) == k_notEditableValueCellType) {
+        memoizedValueForCell(i, j);
       }
     }
   }
-  return memoizedBufferAtIndex((valuesJ-m_firstMemoizedRow)*nbOfMemoizedColumns + (valuesI-m_firstMemoizedColumn));
+}
+
+void ValuesController::PrefetchTimer::start() {
+  if (!m_isRunning) {
+    TimerManager::AddTimer(this);
+    m_isRunning = true;
+  }
+}
+
+void ValuesController::PrefetchTimer::stop() {
+  if (m_isRunning) {
+    TimerManager::RemoveTimer(this);
+    m_isRunning = false;
+  }
+}
+
+bool ValuesController::PrefetchTimer::fire() {
+  m_controller->prefetchRows();
+  stop();
+  // The prefetched rows are not displayed yet
+  return false;
 }
 
 }
@@ -8,8 +8,10 @@
 #include "interval.h"
 #include "values_parameter_controller.h"
 #include "values_function_parameter_controller.h"
+#include "values_memoization.h"
 #include "interval_parameter_controller.h"
 #include <apps/i18n.h>
+#include <poincare/coordinate_2D.h>
 
 namespace Shared {
 
@@ -74,18 +76,18 @@ protected:
   mutable bool m_numberOfColumnsNeedUpdate;
 
   /* Function evaluation memoization
-   * We memoize value cell buffers in order to increase scrolling speed. However,
-   * abscissa cells are not memoized (their computation does not require any
-   * expression evaluation and is therefore not significantly long).
-   * In the following, we refer to 3 different tables:
+   * We memoize the evaluations of the value cells in order to increase
+   * scrolling speed. However, abscissa cells are not memoized (their
+   * computation does not require any expression evaluation and is therefore
+   * not significantly long).
+   * In the following, we refer to 2 different tables:
    * - the absolute table - the complete displayed table
    * - the table of values cells only (the absolute table from which we pruned
    *   the titles and the abscissa columns)
-   * - the memoized table (which is a subset of the table of values cells)
    */
-  void resetMemoization();
-  virtual char * memoizedBufferAtIndex(int i) = 0;
-  virtual int numberOfMemoizedColumn() = 0;
+  static constexpr int k_valuesCellBufferSize = 2*Poincare::PrintFloat::charSizeForFloatsWithPrecision(Poincare::Preferences::LargeNumberOfSignificantDigits)+3; // The largest buffer holds (-1.234567E-123;-1.234567E-123)
+  void resetMemoization() { memoization()->reset(); }
+  virtual ValuesMemoization * memoization() = 0;
 private:
   // Specialization depending on the abscissa names (x, n, t...)
   virtual void setStartEndMessages(Shared::IntervalParameterController * controller, int column) = 0;
@@ -106,17 +108,32 @@ private:
   int valuesRowForAbsoluteRow(int row) { return row - 1; } // Subtract the title row
   virtual int absoluteColumnForValuesColumn(int column) { return column + 1; } // Add the abscissa column
   int absoluteRowForValuesRow(int row) { return row + 1; } // Add the title row
-  // Coordinates of memoizedBufferForCell refer to the absolute table
-  char * memoizedBufferForCell(int i, int j);
-  virtual int valuesCellBufferSize() const = 0;
-  // Coordinates of fillMemoizedBuffer refer to the absolute table but the index
-  // refers to the memoized table
-  virtual void fillMemoizedBuffer(int i, int j, int index) = 0;
-  /* m_firstMemoizedColumn and m_firstMemoizedRow are coordinates of the table
-   * of values cells.*/
+  // Coordinates of memoizedValueForCell refer to the absolute table
+  Poincare::Coordinate2D<double> memoizedValueForCell(int i, int j);
+  // Coordinates of EvaluateValuesCell refer to the table of values cells only
+  static Poincare::Coordinate2D<double> EvaluateValuesCell(int column, int row, void * controller);
+  // Coordinates of evaluateAtLocation refer to the absolute table
+  virtual Poincare::Coordinate2D<double> evaluateAtLocation(int i, int j) = 0;
+  virtual void printEvaluation(char * buffer, int bufferSize, Poincare::Coordinate2D<double> evaluation, int column) = 0;
   virtual int numberOfColumnsForAbscissaColumn(int column) { assert(column == 0); return numberOfColumns(); }
-  mutable int m_firstMemoizedColumn;
-  mutable int m_firstMemoizedRow;
+
+  /* Between key events, the prefetch timer evaluates the rows which are about
+   * to be displayed, in the direction the table was last scrolled to. Once
+   * they are memoized, it stops until the table displays cells again. */
+  class PrefetchTimer : public Timer {
+  public:
+    PrefetchTimer(ValuesController * controller) : Timer(1), m_controller(controller), m_isRunning(false) {}
+    void start();
+    void stop();
+  private:
+    bool fire() override;
+    ValuesController * m_controller;
+    bool m_isRunning;
+  };
+  void prefetchRows();
+  PrefetchTimer m_prefetchTimer;
+  int m_lastPrefetchSelectedRow;
+  int m_prefetchDirection;
 
   virtual Interval * intervalAtColumn(int columnIndex) = 0;
   virtual I18n::Message valuesParameterMessageAtColumn(int columnIndex) const = 0;
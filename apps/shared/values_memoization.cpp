@@ -0,0 +1,36 @@
+#include "values_memoization.h"
+#include <assert.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+constexpr int ValuesMemoization::k_numberOfRows;
+constexpr int ValuesMemoization::k_numberOfPrefetchedRows;
+
+Coordinate2D<double> ValuesMemoization::valueAtCell(int column, int row, Evaluation evaluation, void * context) {
+  assert(column >= 0 && row >= 0);
+  Value * value = valueForCell(column, row);
+  if (value->column != column || value->row != row) {
+    value->value = evaluation(column, row, context);
+    value->column = column;
+    value->row = row;
+  }
+  return value->value;
+}
+
+void ValuesMemoization::forgetCell(int column, int row) {
+  Value * value = valueForCell(column, row);
+  if (value->column == column && value->row == row) {
+    value->row = -1;
+  }
+}
+
+void ValuesMemoization::reset() {
+  int numberOfValues = k_numberOfRows * m_numberOfColumns;
+  for (int i = 0; i < numberOfValues; i++) {
+    m_values[i].row = -1;
+  }
+}
+
+}
@@ -0,0 +1,53 @@
+#ifndef SHARED_VALUES_MEMOIZATION_H
+#define SHARED_VALUES_MEMOIZATION_H
+
+#include "interval.h"
+#include <poincare/coordinate_2D.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* Memoization of the evaluations of the cells of a values table
+ * The evaluations are kept as doubles, and only formatted when their cell is
+ * displayed. They are stored in a ring of k_numberOfRows rows of
+ * numberOfColumns cells: the cell (column, row) is memoized in the slot
+ * (row % k_numberOfRows, column % numberOfColumns), which is tagged with its
+ * coordinates. The ring has as many rows as the longest interval, so that
+ * scrolling back over a column never evaluates its cells again. */
+
+class ValuesMemoization {
+public:
+  typedef Poincare::Coordinate2D<double> (*Evaluation)(int column, int row, void * context);
+  struct Value {
+    Value() : column(-1), row(-1) {}
+    Poincare::Coordinate2D<double> value;
+    int16_t column;
+    int16_t row;
+  };
+  static constexpr int k_numberOfRows = Interval::k_maxNumberOfElements;
+  // Between key events, a screenful of rows is evaluated ahead of time
+  static constexpr int k_numberOfPrefetchedRows = 10;
+
+  ValuesMemoization(Value * values, int numberOfColumns) :
+    m_values(values),
+    m_numberOfColumns(numberOfColumns)
+  {}
+  Poincare::Coordinate2D<double> valueAtCell(int column, int row, Evaluation evaluation, void * context);
+  void forgetCell(int column, int row);
+  void reset();
+  /* The rows to prefetch follow the numberOfDisplayedRows rows displayed from
+   * firstDisplayedRow, in the direction the table is scrolled to. */
+  static int FirstPrefetchedRow(int firstDisplayedRow, int numberOfDisplayedRows, int direction) {
+    return direction > 0 ? firstDisplayedRow + numberOfDisplayedRows : firstDisplayedRow - k_numberOfPrefetchedRows;
+  }
+private:
+  Value * valueForCell(int column, int row) {
+    return &m_values[(row % k_numberOfRows) * m_numberOfColumns + column % m_numberOfColumns];
+  }
+  Value * m_values;
+  int m_numberOfColumns;
+};
+
+}
+
+#endif
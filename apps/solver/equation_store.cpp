@@ -90,28 +90,19 @@ void EquationStore::setIntervalBound(int index, double value) {
 }
 
 void EquationStore::approximateSolve(Poincare::Context * context, bool shouldReplaceFunctionsButNotSymbols) {
-  m_hasMoreThanMaxNumberOfApproximateSolution = false;
   Expression undevelopedExpression = modelForRecord(definedRecordAtIndex(0))->standardForm(context, shouldReplaceFunctionsButNotSymbols, ExpressionNode::ReductionTarget::SystemForApproximation);
   m_userVariablesUsed = !shouldReplaceFunctionsButNotSymbols;
   assert(m_variables[0][0] != 0 && m_variables[1][0] == 0);
   assert(m_type == Type::Monovariable);
-  m_numberOfSolutions = 0;
-  double start = m_intervalApproximateSolutions[0];
   double step = (m_intervalApproximateSolutions[1]-m_intervalApproximateSolutions[0])*k_precision;
-  double root;
-  for (int i = 0; i <= k_maxNumberOfApproximateSolutions; i++) {
-    root = PoincareHelpers::NextRoot(undevelopedExpression, m_variables[0], start, step, m_intervalApproximateSolutions[1], context);
-    if (i == k_maxNumberOfApproximateSolutions) {
-      m_hasMoreThanMaxNumberOfApproximateSolution = !std::isnan(root);
-      break;
-    }
-    m_approximateSolutions[i] = root;
-    if (std::isnan(m_approximateSolutions[i])) {
-      break;
-    } else {
-      start = m_approximateSolutions[i];
-      m_numberOfSolutions++;
-    }
+  /* All the roots are found in a single sweep of the interval. One more root
+   * than displayed is looked for to know if there are more solutions. */
+  double roots[k_maxNumberOfApproximateSolutions + 1];
+  int numberOfRoots = PoincareHelpers::Roots(undevelopedExpression, m_variables[0], m_intervalApproximateSolutions[0], step, m_intervalApproximateSolutions[1], roots, k_maxNumberOfApproximateSolutions + 1, context);
+  m_hasMoreThanMaxNumberOfApproximateSolution = numberOfRoots > k_maxNumberOfApproximateSolutions;
+  m_numberOfSolutions = m_hasMoreThanMaxNumberOfApproximateSolution ? k_maxNumberOfApproximateSolutions : numberOfRoots;
+  for (int i = 0; i < m_numberOfSolutions; i++) {
+    m_approximateSolutions[i] = roots[i];
   }
 }
 
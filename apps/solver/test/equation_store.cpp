@@ -95,6 +95,13 @@ QUIZ_CASE(equation_solve) {
 
   assert_solves_to_error("(x-10)^7=0", RequireApproximateSolution);
   assert_solves_numerically_to("(x-10)^7=0", -100, 100, {10});
+
+  // Roots closer than the sampling step and roots at extrema
+  assert_solves_to_error("(x-1)(x-1.5)ℯ^x=0", RequireApproximateSolution);
+  assert_solves_numerically_to("(x-1)(x-1.5)ℯ^x=0", -100, 100, {1.0, 1.5});
+  assert_solves_numerically_to("(x-1)^2ℯ^x=0", -100, 100, {1.0});
+  assert_solves_numerically_to("(x-3)^2(x+4)ℯ^x=0", -10, 10, {-4.0, 3.0});
+  assert_solves_numerically_to("cos(x)^2=0", -100, 300, {-90.0, 90.0, 270.0});
 }
 
 
@@ -15,6 +15,8 @@ EPSILON_I18N ?= en fr nl pt it de es hu
 EPSILON_COUNTRIES ?= WW CA DE ES FR GB IT NL PT US
 EPSILON_GETOPT ?= 0
 ESCHER_LOG_EVENTS_BINARY ?= 0
+ESCHER_LOG_EVENT_LATENCY ?= 0
 THEME_NAME ?= upsilon_light
 THEME_REPO ?= local
 INCLUDE_ULAB ?= 1
+ULAB_TYPED_KERNELS ?= 1
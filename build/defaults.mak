@@ -8,6 +8,7 @@ endif
 SFLAGS += -DEPSILON_GETOPT=$(EPSILON_GETOPT)
 SFLAGS += -DEPSILON_TELEMETRY=$(EPSILON_TELEMETRY)
 SFLAGS += -DESCHER_LOG_EVENTS_BINARY=$(ESCHER_LOG_EVENTS_BINARY)
+SFLAGS += -DESCHER_LOG_EVENT_LATENCY=$(ESCHER_LOG_EVENT_LATENCY)
 
 # Language-specific flags
 CFLAGS = -std=c99
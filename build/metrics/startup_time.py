@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+# Measure the time to the first frame of the simulator
+#
+# Without any event to replay, a headless simulator draws its first frame and
+# terminates, so the time it runs for is its time to the first frame. Build the
+# simulator with "make PLATFORM=simulator epsilon.bin", then run:
+#   build/metrics/startup_time.py output/release/simulator/linux/epsilon.bin
+
+import argparse
+import os
+import statistics
+import subprocess
+import time
+
+parser = argparse.ArgumentParser(description="Measure the time to the first frame of a headless simulator.")
+parser.add_argument('binary', help='simulator to run')
+parser.add_argument('-n', '--runs', type=int, default=50, help='number of runs')
+parser.add_argument('-v', '--volatile', action='store_true', help='neither load nor save the Python scripts')
+
+def time_to_first_frame(command):
+  start = time.perf_counter()
+  subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=True)
+  return (time.perf_counter() - start) * 1000
+
+def main():
+  args = parser.parse_args()
+  command = [os.path.abspath(args.binary), "--headless"]
+  if args.volatile:
+    command.append("--volatile")
+  durations = [time_to_first_frame(command) for _ in range(args.runs)]
+  print("median %6.2f ms, min %6.2f ms, max %6.2f ms" % (statistics.median(durations), min(durations), max(durations)))
+
+if __name__ == "__main__":
+  main()
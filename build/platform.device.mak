@@ -3,6 +3,7 @@ USE_LIBA = 1
 EXE = elf
 
 EPSILON_TELEMETRY ?= 0
+ULAB_TYPED_KERNELS = 0
 
 BUILD_DIR := $(BUILD_DIR)/$(MODEL)
 
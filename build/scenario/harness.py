@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# Play a corpus of scenari on all cores and report the failing ones
+#
+# Each scenario is a state file (see ion/src/simulator/shared/state_file.cpp)
+# replayed by a headless simulator in its own process, so that a crash only
+# takes one scenario down. Build the simulator with "make scenario_harness",
+# then run:
+#   build/scenario/harness.py output/scenario_harness/epsilon.bin scenari/
+
+import argparse
+import multiprocessing
+import os
+import signal
+import subprocess
+import sys
+import time
+
+parser = argparse.ArgumentParser(description="Play scenari on a headless simulator and report crashes, assertion failures, pool exhaustions, hangs and slow events.")
+parser.add_argument('binary', help='headless simulator to run')
+parser.add_argument('scenari', nargs='+', help='scenario files or folders of scenario files')
+parser.add_argument('-j', '--jobs', type=int, default=multiprocessing.cpu_count(), help='number of simulators run in parallel')
+parser.add_argument('-t', '--timeout', type=float, default=10, help='seconds after which a scenario is considered hung')
+parser.add_argument('-s', '--slow-event-threshold', type=int, default=500, help='milliseconds above which an event is reported as slow, 0 to disable')
+parser.add_argument('-o', '--output', help='file to write the report to, instead of stdout')
+
+CATEGORIES = [
+  ("crash", "Crashes"),
+  ("assertion", "Assertion failures"),
+  ("pool", "Pool exhaustions"),
+  ("hang", "Hangs"),
+  ("slow", "Slow events"),
+]
+
+# Only the exceptions reaching the checkpoint of the apps container are seen
+NOTES = {
+  "pool": "Exhaustions handled by the apps themselves, such as the memory full error of Calculation, are not detected.",
+}
+
+def scenario_files(paths):
+  for path in paths:
+    if os.path.isdir(path):
+      for root, _, names in os.walk(path):
+        for name in sorted(names):
+          yield os.path.join(root, name)
+    else:
+      yield path
+
+def play(job):
+  binary, scenario, timeout, threshold = job
+  command = [binary, "--headless", "--volatile", "--load-state-file", scenario, "--slow-event-threshold", str(threshold)]
+  try:
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, timeout=timeout)
+  except subprocess.TimeoutExpired:
+    return (scenario, [("hang", "no termination after %gs" % timeout)])
+  stdout = result.stdout.decode(errors="replace")
+  stderr = result.stderr.decode(errors="replace")
+  findings = []
+  if result.returncode != 0:
+    if result.returncode == -signal.SIGABRT and "Assertion" in stderr:
+      detail = next(l for l in stderr.splitlines() if "Assertion" in l)
+      findings.append(("assertion", detail.strip()))
+    elif result.returncode < 0:
+      findings.append(("crash", signal.Signals(-result.returncode).name))
+    else:
+      findings.append(("crash", "exit code %d" % result.returncode))
+  if "TelemetryEvent: Exception, PoolMemoryFull" in stdout:
+    findings.append(("pool", "the pool was exhausted"))
+  for line in stderr.splitlines():
+    if line.startswith("Slow event"):
+      findings.append(("slow", line.strip()))
+  return (scenario, findings)
+
+def write_report(output, results, numberOfScenari, duration):
+  output.write("Played %d scenari in %.1fs (%d scenari per minute)\n" % (numberOfScenari, duration, numberOfScenari * 60 / max(duration, 1e-3)))
+  for category, title in CATEGORIES:
+    # Scenari failing the same way are grouped, most frequent failure first
+    groups = {}
+    for scenario, findings in results:
+      for c, detail in findings:
+        if c == category:
+          groups.setdefault(detail, []).append(scenario)
+    output.write("\n%s: %d\n" % (title, sum(len(g) for g in groups.values())))
+    if category in NOTES:
+      output.write("  (%s)\n" % NOTES[category])
+    for detail, scenari in sorted(groups.items(), key=lambda g: (-len(g[1]), g[0])):
+      output.write("  %s (%d)\n" % (detail, len(scenari)))
+      for scenario in sorted(scenari):
+        output.write("    %s\n" % scenario)
+
+def main():
+  args = parser.parse_args()
+  scenari = list(scenario_files(args.scenari))
+  jobs = [(os.path.abspath(args.binary), s, args.timeout, args.slow_event_threshold) for s in scenari]
+  start = time.time()
+  results = []
+  with multiprocessing.Pool(args.jobs) as pool:
+    # Small chunks keep the cores busy when some scenari are much longer
+    for scenario, findings in pool.imap_unordered(play, jobs, chunksize=4):
+      if findings:
+        results.append((scenario, findings))
+  duration = time.time() - start
+  if args.output:
+    with open(args.output, "w") as output:
+      write_report(output, results, len(scenari), duration)
+  else:
+    write_report(sys.stdout, results, len(scenari), duration)
+  failures = [r for r in results if any(c != "slow" for c, _ in r[1])]
+  sys.exit(1 if failures else 0)
+
+if __name__ == "__main__":
+  main()
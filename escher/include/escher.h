@@ -23,10 +23,12 @@
 #include <escher/even_odd_editable_text_cell.h>
 #include <escher/even_odd_expression_cell.h>
 #include <escher/even_odd_message_text_cell.h>
+#include <escher/event_latency_log.h>
 #include <escher/expression_table_cell.h>
 #include <escher/expression_table_cell_with_pointer.h>
 #include <escher/expression_table_cell_with_expression.h>
 #include <escher/expression_view.h>
+#include <escher/frame_pacer.h>
 #include <escher/gauge_view.h>
 #include <escher/highlight_cell.h>
 #include <escher/icon_view.h>
@@ -40,6 +42,7 @@
 #include <escher/layout_field.h>
 #include <escher/layout_field_delegate.h>
 #include <escher/list_view_data_source.h>
+#include <escher/memoized_list_view_data_source.h>
 #include <escher/message_table_cell.h>
 #include <escher/message_table_cell_with_buffer.h>
 #include <escher/message_table_cell_with_chevron.h>
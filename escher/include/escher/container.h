@@ -33,9 +33,12 @@ public:
   virtual bool switchTo(App::Snapshot * snapshot);
 protected:
   virtual Window * window() = 0;
+  void drawSkippedFrame() override { drawFrame(); }
   static App * s_activeApp;
 private:
   void step();
+  void drawFrame();
+  bool canSkipFrameAfterEvent(Ion::Events::Event event, Responder * responder) const;
 };
 
 #endif
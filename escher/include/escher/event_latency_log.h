@@ -0,0 +1,67 @@
+#ifndef ESCHER_EVENT_LATENCY_LOG_H
+#define ESCHER_EVENT_LATENCY_LOG_H
+
+#include <escher/i18n.h>
+#include <ion/events.h>
+#include <stdint.h>
+
+/* EventLatencyLog keeps the timings of the last events dispatched by the
+ * Container, when Escher is built with ESCHER_LOG_EVENT_LATENCY=1. For each
+ * event, it records:
+ * - the queue duration, from the return of Ion::Events::getEvent to the
+ *   dispatch of the event, during which the timers fire,
+ * - the dispatch duration, spent by the app to handle the event, which
+ *   includes the model computations and the layouts,
+ * - the redraw duration, spent by the window to draw its dirty views and push
+ *   them to the display.
+ * Their sum is the input-to-photon latency of the event. The time spent in
+ * getEvent is left out: it is mostly spent waiting for a key, and the time
+ * at which the key was pressed is unknown. Durations are in
+ * milliseconds, as given by Ion::Timing::millis. The RunLoop dumps the log
+ * each time it is full, and on termination. */
+
+class EventLatencyLog {
+public:
+  enum class Phase : uint8_t {
+    Queue,
+    Dispatch,
+    Redraw,
+    Total
+  };
+  class Record {
+  public:
+    Record() : m_app((I18n::Message)0), m_event(0), m_queueDuration(0), m_dispatchDuration(0), m_redrawDuration(0) {}
+    Record(I18n::Message app, Ion::Events::Event event, uint16_t queueDuration, uint16_t dispatchDuration, uint16_t redrawDuration) :
+      m_app(app), m_event(static_cast<uint8_t>(event)), m_queueDuration(queueDuration), m_dispatchDuration(dispatchDuration), m_redrawDuration(redrawDuration) {}
+    I18n::Message app() const { return m_app; }
+    Ion::Events::Event event() const { return Ion::Events::Event(m_event); }
+    uint16_t duration(Phase phase) const;
+  private:
+    I18n::Message m_app;
+    uint8_t m_event;
+    uint16_t m_queueDuration;
+    uint16_t m_dispatchDuration;
+    uint16_t m_redrawDuration;
+  };
+  constexpr static int k_numberOfRecords = 128;
+  static EventLatencyLog * sharedLog();
+  EventLatencyLog() : m_numberOfRecords(0), m_nextRecordIndex(0) {}
+  void addRecord(I18n::Message app, Ion::Events::Event event, uint64_t queueDuration, uint64_t dispatchDuration, uint64_t redrawDuration);
+  void reset() { m_numberOfRecords = 0; m_nextRecordIndex = 0; }
+  int numberOfRecords() const { return m_numberOfRecords; }
+  bool isFull() const { return m_numberOfRecords == k_numberOfRecords; }
+  // The most recent record is at index 0
+  const Record * recordAtIndex(int index) const;
+  /* Percentile of the duration of a phase among the events dispatched to app.
+   * A null app selects the events of all apps. */
+  uint16_t percentile(int percent, Phase phase, I18n::Message app = (I18n::Message)0) const;
+  /* Write the records, the p50/p99 latencies and the number of frames skipped
+   * by the FramePacer to Ion::Console */
+  void dump(uint32_t numberOfSkippedFrames) const;
+private:
+  Record m_records[k_numberOfRecords];
+  int m_numberOfRecords;
+  int m_nextRecordIndex;
+};
+
+#endif
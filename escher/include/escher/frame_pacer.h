@@ -0,0 +1,42 @@
+#ifndef ESCHER_FRAME_PACER_H
+#define ESCHER_FRAME_PACER_H
+
+#include <stdint.h>
+
+/* When a key is held, its event repeats every few tens of milliseconds. In the
+ * heaviest views, a redraw takes longer than that: redrawing after each event
+ * then slows the repetition down, and the screen lags behind the key.
+ * The FramePacer lets the Container skip the redraw following some events.
+ * The dirty rectangles of the window accumulate meanwhile, and the next frame
+ * draws the effect of the whole batch of events at once.
+ * The budget adapts to the cost of the frames: a frame can be skipped until
+ * the time elapsed since the end of the last drawn frame reaches the duration
+ * of that frame, so that redraws take at most half of the time. Frames faster
+ * than k_minSkippableFrameDuration are never skipped. Durations are in
+ * milliseconds, as given by Ion::Timing::millis. */
+
+class FramePacer {
+public:
+  constexpr static uint32_t k_minSkippableFrameDuration = 20;
+  FramePacer() :
+    m_lastFrameEndTime(0),
+    m_lastFrameDuration(0),
+    m_numberOfSkippedFrames(0),
+    m_hasPendingFrame(false)
+  {}
+  bool canSkipFrame(uint64_t time) const;
+  void skipFrame();
+  void didDrawFrame(uint64_t startTime, uint64_t endTime);
+  // A frame was skipped and nothing has been drawn since
+  bool hasPendingFrame() const { return m_hasPendingFrame; }
+  uint32_t lastFrameDuration() const { return m_lastFrameDuration; }
+  uint32_t numberOfSkippedFrames() const { return m_numberOfSkippedFrames; }
+  void resetNumberOfSkippedFrames() { m_numberOfSkippedFrames = 0; }
+private:
+  uint64_t m_lastFrameEndTime;
+  uint32_t m_lastFrameDuration;
+  uint32_t m_numberOfSkippedFrames;
+  bool m_hasPendingFrame;
+};
+
+#endif
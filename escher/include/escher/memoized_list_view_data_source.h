@@ -0,0 +1,38 @@
+#ifndef ESCHER_MEMOIZED_LIST_VIEW_DATA_SOURCE_H
+#define ESCHER_MEMOIZED_LIST_VIEW_DATA_SOURCE_H
+
+#include <escher/list_view_data_source.h>
+
+/* MemoizedListViewDataSource is a ListViewDataSource for lists whose rows have
+ * different heights. TableViewDataSource computes cumulated heights by summing
+ * all the previous row heights, which makes each layout of the table
+ * quadratic in the number of rows.
+ * Here, the heights of the first k_memoizedRowsCount rows are memoized in a
+ * Fenwick tree: cumulated heights are computed in O(log(n)), offsets are
+ * turned into row indexes with a binary search and the height of one row can
+ * be updated in O(log(n)). Rows are memoized lazily, up to the one needed, and
+ * the rows after k_memoizedRowsCount are summed one by one.
+ * The memoization is reset when the table view reloads its data. Data sources
+ * whose row heights change otherwise must call resetMemoizedHeights or
+ * memoizedRowHeightDidChange. */
+
+class MemoizedListViewDataSource : public ListViewDataSource {
+public:
+  constexpr static int k_memoizedRowsCount = 256;
+  MemoizedListViewDataSource();
+  KDCoordinate cumulatedHeightFromIndex(int j) override;
+  int indexFromCumulatedHeight(KDCoordinate offsetY) override;
+  void resetMemoizedHeights() override;
+  void memoizedRowHeightDidChange(int j);
+private:
+  void forgetRowsAfterLastRow();
+  void memoizeNextRow();
+  KDCoordinate memoizedCumulatedHeight(int j) const;
+  int m_numberOfMemoizedRows;
+  KDCoordinate m_memoizedHeight;
+  /* m_fenwickTree[k-1] is the sum of the heights of rows k-lowbit(k) to k-1,
+   * where lowbit(k) is the lowest bit set in k. */
+  KDCoordinate m_fenwickTree[k_memoizedRowsCount];
+};
+
+#endif
@@ -3,11 +3,11 @@
 
 #include <escher/input_event_handler.h>
 #include <escher/highlight_cell.h>
-#include <escher/list_view_data_source.h>
+#include <escher/memoized_list_view_data_source.h>
 #include <escher/selectable_table_view.h>
 #include <escher/stack_view_controller.h>
 
-class NestedMenuController : public StackViewController, public ListViewDataSource, public SelectableTableViewDataSource, public SelectableTableViewDelegate {
+class NestedMenuController : public StackViewController, public MemoizedListViewDataSource, public SelectableTableViewDataSource, public SelectableTableViewDelegate {
 public:
   NestedMenuController(Responder * parentResponder, I18n::Message title = (I18n::Message)0);
   void setSender(InputEventHandler * sender) { m_sender = sender; }
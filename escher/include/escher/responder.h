@@ -11,6 +11,10 @@ public:
   virtual void willResignFirstResponder() {}
   virtual void didEnterResponderChain(Responder * previousFirstResponder) {}
   virtual void willExitResponderChain(Responder * nextFirstResponder) {}
+  /* When a key is held, the Container may skip the redraw between its repeated
+   * events, if the first responder handles them without relying on what was
+   * drawn. The responders of the heaviest views opt in. */
+  virtual bool allowsEventCoalescing() const { return false; }
   Responder * parentResponder() const { return m_parentResponder; }
   Responder * commonAncestorWith(Responder * responder);
   void setParentResponder(Responder * responder) { m_parentResponder = responder; }
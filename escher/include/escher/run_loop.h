@@ -2,6 +2,7 @@
 #define ESCHER_RUN_LOOP_H
 
 #include <ion.h>
+#include <escher/frame_pacer.h>
 #include <escher/timer.h>
 
 class RunLoop {
@@ -11,8 +12,16 @@ public:
   void runWhile(bool (*callback)(void * ctx), void * ctx);
   void addTimer(Timer * timer);
   void removeTimer(Timer * timer);
+  const FramePacer * framePacer() const { return &m_framePacer; }
 protected:
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
+  // Draw the frame skipped after the last events dispatched
+  virtual void drawSkippedFrame() {}
+  FramePacer m_framePacer;
+#if ESCHER_LOG_EVENT_LATENCY
+  // Time at which Ion::Events::getEvent returned the event being dispatched
+  uint64_t m_eventFetchEndTime;
+#endif
 private:
   bool step();
   int m_time;
@@ -24,6 +24,9 @@ public:
   virtual HighlightCell * reusableCell(int index, int type) = 0;
   virtual int reusableCellCount(int type) = 0;
   virtual int typeAtLocation(int i, int j) = 0;
+  /* Called when the table view reloads its data: data sources memoizing the
+   * row heights must forget them. */
+  virtual void resetMemoizedHeights() {}
 };
 
 #endif
@@ -79,6 +79,10 @@ private:
   virtual View * subviewAtIndex(int index) { return nullptr; }
   virtual void layoutSubviews(bool force = false) {}
   virtual const Window * window() const;
+  /* Views blending many small shapes into what they have already drawn, such
+   * as anti-aliased curves, should draw through a KDTileContext to avoid
+   * reading the screen back for each shape. */
+  virtual bool drawsThroughTile() const { return false; }
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
@@ -1,4 +1,5 @@
 #include <escher/container.h>
+#include <escher/event_latency_log.h>
 #include <assert.h>
 
 Container::Container() :
@@ -34,24 +35,57 @@ bool Container::switchTo(App::Snapshot * snapshot) {
   }
   if (s_activeApp) {
     s_activeApp->didBecomeActive(window());
-    window()->redraw();
+    drawFrame();
   }
   return true;
 }
 
 bool Container::dispatchEvent(Ion::Events::Event event) {
   if (event == Ion::Events::TimerFire ) {
-    window()->redraw();
+    drawFrame();
     return true;
   }
-  if (s_activeApp->processEvent(event)) {
-    window()->redraw();
-    return true;
+#if ESCHER_LOG_EVENT_LATENCY
+  I18n::Message app = s_activeApp->snapshot()->descriptor()->name();
+  uint64_t fetchEndTime = m_eventFetchEndTime;
+  uint64_t dispatchStartTime = Ion::Timing::millis();
+#endif
+  Responder * responder = s_activeApp->firstResponder();
+  bool didProcessEvent = s_activeApp->processEvent(event);
+#if ESCHER_LOG_EVENT_LATENCY
+  uint64_t redrawStartTime = Ion::Timing::millis();
+#endif
+  if (didProcessEvent) {
+    if (canSkipFrameAfterEvent(event, responder)) {
+      m_framePacer.skipFrame();
+    } else {
+      drawFrame();
+    }
   }
-  return false;
+#if ESCHER_LOG_EVENT_LATENCY
+  uint64_t redrawEndTime = Ion::Timing::millis();
+  EventLatencyLog::sharedLog()->addRecord(app, event, dispatchStartTime - fetchEndTime, redrawStartTime - dispatchStartTime, redrawEndTime - redrawStartTime);
+#endif
+  return didProcessEvent;
 }
 
 void Container::run() {
-  window()->redraw();
+  drawFrame();
   RunLoop::run();
 }
+
+void Container::drawFrame() {
+  uint64_t startTime = Ion::Timing::millis();
+  window()->redraw();
+  m_framePacer.didDrawFrame(startTime, Ion::Timing::millis());
+}
+
+bool Container::canSkipFrameAfterEvent(Ion::Events::Event event, Responder * responder) const {
+  /* Only the repetitions of a held key are coalesced, as long as they are
+   * handled by the same responder, which lets their frames be skipped. */
+  return event.isRepeatable()
+    && responder != nullptr
+    && responder == s_activeApp->firstResponder()
+    && responder->allowsEventCoalescing()
+    && m_framePacer.canSkipFrame(Ion::Timing::millis());
+}
@@ -0,0 +1,96 @@
+#include <escher/event_latency_log.h>
+#include <ion/console.h>
+#include <poincare/print_int.h>
+#include <assert.h>
+
+static inline uint16_t clampedDuration(uint64_t duration) {
+  return duration > UINT16_MAX ? UINT16_MAX : duration;
+}
+
+uint16_t EventLatencyLog::Record::duration(Phase phase) const {
+  switch (phase) {
+    case Phase::Queue:
+      return m_queueDuration;
+    case Phase::Dispatch:
+      return m_dispatchDuration;
+    case Phase::Redraw:
+      return m_redrawDuration;
+    default:
+      assert(phase == Phase::Total);
+      return clampedDuration(static_cast<uint64_t>(m_queueDuration) + m_dispatchDuration + m_redrawDuration);
+  }
+}
+
+EventLatencyLog * EventLatencyLog::sharedLog() {
+  static EventLatencyLog log;
+  return &log;
+}
+
+void EventLatencyLog::addRecord(I18n::Message app, Ion::Events::Event event, uint64_t queueDuration, uint64_t dispatchDuration, uint64_t redrawDuration) {
+  m_records[m_nextRecordIndex] = Record(app, event, clampedDuration(queueDuration), clampedDuration(dispatchDuration), clampedDuration(redrawDuration));
+  m_nextRecordIndex = (m_nextRecordIndex + 1) % k_numberOfRecords;
+  if (m_numberOfRecords < k_numberOfRecords) {
+    m_numberOfRecords++;
+  }
+}
+
+const EventLatencyLog::Record * EventLatencyLog::recordAtIndex(int index) const {
+  assert(index >= 0 && index < m_numberOfRecords);
+  return m_records + (m_nextRecordIndex - 1 - index + k_numberOfRecords) % k_numberOfRecords;
+}
+
+uint16_t EventLatencyLog::percentile(int percent, Phase phase, I18n::Message app) const {
+  assert(percent >= 0 && percent <= 100);
+  // Insertion sort of the selected durations, there are few of them
+  uint16_t durations[k_numberOfRecords];
+  int numberOfDurations = 0;
+  for (int i = 0; i < m_numberOfRecords; i++) {
+    if (app != (I18n::Message)0 && m_records[i].app() != app) {
+      continue;
+    }
+    uint16_t duration = m_records[i].duration(phase);
+    int j = numberOfDurations++;
+    while (j > 0 && durations[j-1] > duration) {
+      durations[j] = durations[j-1];
+      j--;
+    }
+    durations[j] = duration;
+  }
+  if (numberOfDurations == 0) {
+    return 0;
+  }
+  // Nearest-rank percentile
+  int rank = (percent * numberOfDurations + 99) / 100;
+  return durations[rank > 0 ? rank - 1 : 0];
+}
+
+static void writeInteger(int value, bool appendCRLF = false) {
+  constexpr int bufferLength = 12;
+  char buffer[bufferLength];
+  int length = Poincare::PrintInt::Left(value, buffer, bufferLength - 1);
+  buffer[length] = 0;
+  Ion::Console::writeLine(buffer, appendCRLF);
+}
+
+void EventLatencyLog::dump(uint32_t numberOfSkippedFrames) const {
+  Ion::Console::writeLine("EventLatency: app, event, queue, dispatch, redraw");
+  for (int i = m_numberOfRecords - 1; i >= 0; i--) {
+    const Record * record = recordAtIndex(i);
+    Ion::Console::writeLine(record->app() == (I18n::Message)0 ? "-" : I18n::translate(record->app()), false);
+    Ion::Console::writeLine(", ", false);
+    writeInteger(static_cast<uint8_t>(record->event()));
+    Ion::Console::writeLine(", ", false);
+    writeInteger(record->duration(Phase::Queue));
+    Ion::Console::writeLine(", ", false);
+    writeInteger(record->duration(Phase::Dispatch));
+    Ion::Console::writeLine(", ", false);
+    writeInteger(record->duration(Phase::Redraw), true);
+  }
+  Ion::Console::writeLine("EventLatency: p50 ", false);
+  writeInteger(percentile(50, Phase::Total));
+  Ion::Console::writeLine(" ms, p99 ", false);
+  writeInteger(percentile(99, Phase::Total));
+  Ion::Console::writeLine(" ms, ", false);
+  writeInteger(numberOfSkippedFrames);
+  Ion::Console::writeLine(" skipped frames");
+}
@@ -0,0 +1,20 @@
+#include <escher/frame_pacer.h>
+#include <assert.h>
+
+bool FramePacer::canSkipFrame(uint64_t time) const {
+  assert(time >= m_lastFrameEndTime);
+  return m_lastFrameDuration >= k_minSkippableFrameDuration
+    && time - m_lastFrameEndTime < m_lastFrameDuration;
+}
+
+void FramePacer::skipFrame() {
+  m_hasPendingFrame = true;
+  m_numberOfSkippedFrames++;
+}
+
+void FramePacer::didDrawFrame(uint64_t startTime, uint64_t endTime) {
+  assert(endTime >= startTime);
+  m_lastFrameEndTime = endTime;
+  m_lastFrameDuration = endTime - startTime;
+  m_hasPendingFrame = false;
+}
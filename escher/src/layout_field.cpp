@@ -29,7 +29,6 @@ bool LayoutField::ContentView::setEditing(bool isEditing) {
     /* showEmptyLayoutIfNeeded is done in LayoutField::handleEvent, so no need
      * to do it here. */
     if (m_cursor.hideEmptyLayoutIfNeeded()) {
-      m_expressionView.layout().invalidAllSizesPositionsAndBaselines();
       return true;
     }
   } else {
@@ -345,7 +344,6 @@ void LayoutField::putCursorRightOfLayout() {
 }
 
 void LayoutField::reload(KDSize previousSize) {
-  layout().invalidAllSizesPositionsAndBaselines();
   KDSize newSize = minimalSizeForOptimalDisplay();
   if (m_delegate && previousSize.height() != newSize.height()) {
     m_delegate->layoutFieldDidChangeSize(this);
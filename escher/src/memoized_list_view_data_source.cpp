@@ -0,0 +1,116 @@
+#include <escher/memoized_list_view_data_source.h>
+#include <assert.h>
+#include <algorithm>
+
+constexpr int MemoizedListViewDataSource::k_memoizedRowsCount;
+
+static inline int lowestBit(int k) { return k & -k; }
+
+MemoizedListViewDataSource::MemoizedListViewDataSource() :
+  ListViewDataSource(),
+  m_numberOfMemoizedRows(0),
+  m_memoizedHeight(0)
+{
+}
+
+KDCoordinate MemoizedListViewDataSource::cumulatedHeightFromIndex(int j) {
+  forgetRowsAfterLastRow();
+  int lastMemoizableRow = std::min(std::min(j, numberOfRows()), k_memoizedRowsCount);
+  while (m_numberOfMemoizedRows < lastMemoizableRow) {
+    memoizeNextRow();
+  }
+  int k = std::min(j, m_numberOfMemoizedRows);
+  KDCoordinate result = memoizedCumulatedHeight(k);
+  while (k < j) {
+    result += rowHeight(k++);
+  }
+  return result;
+}
+
+int MemoizedListViewDataSource::indexFromCumulatedHeight(KDCoordinate offsetY) {
+  if (offsetY <= 0) {
+    // Same results as TableViewDataSource
+    return offsetY == 0 ? 0 : -1;
+  }
+  forgetRowsAfterLastRow();
+  int numberOfRowsToMemoize = std::min(numberOfRows(), k_memoizedRowsCount);
+  while (m_memoizedHeight < offsetY && m_numberOfMemoizedRows < numberOfRowsToMemoize) {
+    memoizeNextRow();
+  }
+  if (m_memoizedHeight >= offsetY) {
+    /* Find the last row whose cumulated height is strictly lower than offsetY
+     * by descending the Fenwick tree. */
+    int index = 0;
+    KDCoordinate remainingHeight = offsetY;
+    for (int step = k_memoizedRowsCount; step > 0; step >>= 1) {
+      int k = index + step;
+      if (k <= m_numberOfMemoizedRows && m_fenwickTree[k-1] < remainingHeight) {
+        index = k;
+        remainingHeight -= m_fenwickTree[k-1];
+      }
+    }
+    return index;
+  }
+  KDCoordinate result = m_memoizedHeight;
+  int j = m_numberOfMemoizedRows;
+  int n = numberOfRows();
+  while (result < offsetY && j < n) {
+    result += rowHeight(j++);
+  }
+  return result < offsetY ? j : j - 1;
+}
+
+void MemoizedListViewDataSource::resetMemoizedHeights() {
+  m_numberOfMemoizedRows = 0;
+  m_memoizedHeight = 0;
+}
+
+void MemoizedListViewDataSource::memoizedRowHeightDidChange(int j) {
+  if (j < 0 || j >= m_numberOfMemoizedRows) {
+    return;
+  }
+  KDCoordinate delta = rowHeight(j) - (memoizedCumulatedHeight(j+1) - memoizedCumulatedHeight(j));
+  if (delta == 0) {
+    return;
+  }
+  for (int k = j + 1; k <= m_numberOfMemoizedRows; k += lowestBit(k)) {
+    m_fenwickTree[k-1] += delta;
+  }
+  m_memoizedHeight += delta;
+}
+
+void MemoizedListViewDataSource::forgetRowsAfterLastRow() {
+  /* Rows might have been removed without reloading the table. Nodes of the
+   * Fenwick tree only depend on the rows before them so the tree of the
+   * remaining rows is still valid. */
+  int n = numberOfRows();
+  if (m_numberOfMemoizedRows > n) {
+    m_numberOfMemoizedRows = std::max(n, 0);
+    m_memoizedHeight = memoizedCumulatedHeight(m_numberOfMemoizedRows);
+  }
+}
+
+void MemoizedListViewDataSource::memoizeNextRow() {
+  assert(m_numberOfMemoizedRows < k_memoizedRowsCount);
+  int j = m_numberOfMemoizedRows;
+  KDCoordinate height = rowHeight(j);
+  /* The node of row j sums its height with the nodes covering the rows from
+   * j+1-lowbit(j+1) to j-1. */
+  int k = j + 1;
+  KDCoordinate node = height;
+  for (int i = j; i > k - lowestBit(k); i -= lowestBit(i)) {
+    node += m_fenwickTree[i-1];
+  }
+  m_fenwickTree[j] = node;
+  m_numberOfMemoizedRows++;
+  m_memoizedHeight += height;
+}
+
+KDCoordinate MemoizedListViewDataSource::memoizedCumulatedHeight(int j) const {
+  assert(j >= 0 && j <= m_numberOfMemoizedRows);
+  KDCoordinate result = 0;
+  for (int k = j; k > 0; k -= lowestBit(k)) {
+    result += m_fenwickTree[k-1];
+  }
+  return result;
+}
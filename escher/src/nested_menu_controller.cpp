@@ -166,6 +166,8 @@ bool NestedMenuController::handleEventForRow(Ion::Events::Event event, int rowIn
 }
 
 bool NestedMenuController::selectSubMenu(int selectedRow) {
+  // The rows of the sub menu replace the memoized ones
+  resetMemoizedHeights();
   m_stack.push(selectedRow, m_selectableTableView.contentOffset().y());
   m_listController.setFirstSelectedRow(0);
   Container::activeApp()->setFirstResponder(&m_listController);
@@ -175,6 +177,8 @@ bool NestedMenuController::selectSubMenu(int selectedRow) {
 bool NestedMenuController::returnToPreviousMenu() {
   assert(m_stack.depth() > 0);
   NestedMenuController::Stack::State state = m_stack.pop();
+  // Scrolling back to the previous state requires its row heights
+  resetMemoizedHeights();
   m_listController.setFirstSelectedRow(state.selectedRow() + stackRowOffset());
   KDPoint scroll = m_selectableTableView.contentOffset();
   m_selectableTableView.setContentOffset(KDPoint(scroll.x(), state.verticalScroll()));
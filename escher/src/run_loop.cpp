@@ -1,8 +1,12 @@
 #include <escher/run_loop.h>
+#include <escher/event_latency_log.h>
 #include <kandinsky/font.h>
 #include <assert.h>
 
 RunLoop::RunLoop() :
+#if ESCHER_LOG_EVENT_LATENCY
+  m_eventFetchEndTime(0),
+#endif
   m_time(0),
   m_firstTimer(nullptr)
 {
@@ -23,6 +27,11 @@ bool RunLoop::step() {
   int timeout = eventDuration;
 
   Ion::Events::Event event = Ion::Events::getEvent(&timeout);
+#if ESCHER_LOG_EVENT_LATENCY
+  /* getEvent blocks until a key is pressed, so the time it takes is mostly
+   * idle time, which is not part of the latency of the event. */
+  m_eventFetchEndTime = Ion::Timing::millis();
+#endif
   assert(event.isDefined());
 
   eventDuration -= timeout;
@@ -65,12 +74,29 @@ bool RunLoop::step() {
     }
 #endif
     dispatchEvent(event);
+  } else if (m_framePacer.hasPendingFrame()) {
+    /* No event came before the timeout, or the repeated key was released: the
+     * batch of events whose frames were skipped is over. */
+    drawSkippedFrame();
   }
 
+#if ESCHER_LOG_EVENT_LATENCY
+  /* The device never terminates, so the log is also dumped, and emptied, each
+   * time it is full. */
+  EventLatencyLog * log = EventLatencyLog::sharedLog();
+  if (event == Ion::Events::Termination || log->isFull()) {
+    log->dump(m_framePacer.numberOfSkippedFrames());
+    log->reset();
+  }
+#endif
+
   return event != Ion::Events::Termination;
 }
 
 void RunLoop::addTimer(Timer * timer) {
+  /* The timer is appended to the list: it may have been removed from it
+   * without forgetting its successor. */
+  timer->setNext(nullptr);
   if (m_firstTimer == nullptr) {
     m_firstTimer = timer;
   } else {
@@ -45,6 +45,7 @@ void SelectableTableView::reloadData(bool setFirstResponder) {
    * order to deselect it). */
   /* As a workaround, datasources can reset the highlighted state in their
    * willDisplayCell callback. */
+  dataSource()->resetMemoizedHeights();
   TableView::layoutSubviews();
   selectCellAtLocation(col, row, setFirstResponder, true);
 }
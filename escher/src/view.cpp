@@ -2,6 +2,14 @@ extern "C" {
 #include <assert.h>
 }
 #include <escher/view.h>
+#include <kandinsky/tile_context.h>
+
+/* The tile context holds a few kilobytes of pixels: keep it out of the stack
+ * frame of the recursive View::redraw. */
+__attribute__((noinline)) static void drawRectThroughTile(const View * view, KDContext * ctx, KDRect rect) {
+  KDTileContext tileContext(ctx);
+  view->drawRect(&tileContext, rect);
+}
 
 const Window * View::window() const {
   if (m_superview == nullptr) {
@@ -48,7 +56,11 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     KDContext * ctx = KDIonContext::sharedContext();
     ctx->setOrigin(absOrigin);
     ctx->setClippingRect(absClippingRect);
-    this->drawRect(ctx, rectNeedingRedraw);
+    if (drawsThroughTile()) {
+      drawRectThroughTile(this, ctx, rectNeedingRedraw);
+    } else {
+      this->drawRect(ctx, rectNeedingRedraw);
+    }
   }
   // This initializes the area that has been redrawn.
   KDRect redrawnArea = rectNeedingRedraw;
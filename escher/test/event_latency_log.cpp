@@ -0,0 +1,42 @@
+#include <quiz.h>
+#include <escher/event_latency_log.h>
+
+constexpr I18n::Message k_firstApp = (I18n::Message)1;
+constexpr I18n::Message k_secondApp = (I18n::Message)2;
+
+QUIZ_CASE(escher_event_latency_log) {
+  EventLatencyLog log;
+  quiz_assert(log.numberOfRecords() == 0);
+  quiz_assert(log.percentile(50, EventLatencyLog::Phase::Total) == 0);
+
+  // Durations 1 to 100 in the first app, 1000 in the second one
+  for (int i = 1; i <= 100; i++) {
+    log.addRecord(k_firstApp, Ion::Events::OK, 0, i - 1, 1);
+  }
+  log.addRecord(k_secondApp, Ion::Events::Back, 400, 600, 0);
+  quiz_assert(log.numberOfRecords() == 101);
+  quiz_assert(log.recordAtIndex(0)->app() == k_secondApp);
+  quiz_assert(log.recordAtIndex(0)->event() == Ion::Events::Back);
+  quiz_assert(log.recordAtIndex(1)->duration(EventLatencyLog::Phase::Total) == 100);
+
+  quiz_assert(log.percentile(50, EventLatencyLog::Phase::Total, k_firstApp) == 50);
+  quiz_assert(log.percentile(99, EventLatencyLog::Phase::Total, k_firstApp) == 99);
+  quiz_assert(log.percentile(100, EventLatencyLog::Phase::Total, k_firstApp) == 100);
+  quiz_assert(log.percentile(99, EventLatencyLog::Phase::Redraw, k_firstApp) == 1);
+  quiz_assert(log.percentile(100, EventLatencyLog::Phase::Total) == 1000);
+  quiz_assert(log.percentile(50, EventLatencyLog::Phase::Queue, k_secondApp) == 400);
+  quiz_assert(log.percentile(50, EventLatencyLog::Phase::Dispatch, k_secondApp) == 600);
+
+  // The oldest records are overwritten
+  quiz_assert(!log.isFull());
+  for (int i = 0; i < EventLatencyLog::k_numberOfRecords; i++) {
+    log.addRecord(k_firstApp, Ion::Events::Up, 0, 70000, 2);
+  }
+  quiz_assert(log.numberOfRecords() == EventLatencyLog::k_numberOfRecords);
+  quiz_assert(log.isFull());
+  quiz_assert(log.percentile(0, EventLatencyLog::Phase::Total) == UINT16_MAX);
+  quiz_assert(log.percentile(50, EventLatencyLog::Phase::Total, k_secondApp) == 0);
+
+  log.reset();
+  quiz_assert(log.numberOfRecords() == 0);
+}
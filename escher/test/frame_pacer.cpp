@@ -0,0 +1,31 @@
+#include <quiz.h>
+#include <escher/frame_pacer.h>
+
+QUIZ_CASE(escher_frame_pacer) {
+  FramePacer pacer;
+  quiz_assert(!pacer.canSkipFrame(0));
+
+  // Fast frames are never skipped
+  pacer.didDrawFrame(0, FramePacer::k_minSkippableFrameDuration - 1);
+  quiz_assert(!pacer.canSkipFrame(FramePacer::k_minSkippableFrameDuration));
+
+  // Frames are skipped until the last one is as old as it was long to draw
+  pacer.didDrawFrame(100, 300);
+  quiz_assert(pacer.lastFrameDuration() == 200);
+  quiz_assert(pacer.canSkipFrame(350));
+  pacer.skipFrame();
+  quiz_assert(pacer.canSkipFrame(499));
+  pacer.skipFrame();
+  quiz_assert(pacer.hasPendingFrame());
+  quiz_assert(!pacer.canSkipFrame(500));
+  quiz_assert(pacer.numberOfSkippedFrames() == 2);
+
+  // The budget follows the duration of the last frame
+  pacer.didDrawFrame(500, 550);
+  quiz_assert(!pacer.hasPendingFrame());
+  quiz_assert(pacer.canSkipFrame(599));
+  quiz_assert(!pacer.canSkipFrame(600));
+
+  pacer.resetNumberOfSkippedFrames();
+  quiz_assert(pacer.numberOfSkippedFrames() == 0);
+}
@@ -0,0 +1,115 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <escher/list_view_data_source.h>
+#include <escher/memoized_list_view_data_source.h>
+#include <escher/table_view.h>
+
+template<typename T>
+class VariableHeightList : public T {
+public:
+  constexpr static int k_maxNumberOfRows = 300;
+  VariableHeightList(int numberOfRows) : m_numberOfRows(numberOfRows) {
+    for (int j = 0; j < k_maxNumberOfRows; j++) {
+      m_heights[j] = 10 + (7 * j) % 23;
+    }
+  }
+  int numberOfRows() const override { return m_numberOfRows; }
+  void setNumberOfRows(int numberOfRows) { m_numberOfRows = numberOfRows; }
+  void setRowHeight(int j, KDCoordinate height) { m_heights[j] = height; }
+  KDCoordinate rowHeight(int j) override { return j < k_maxNumberOfRows ? m_heights[j] : 0; }
+  HighlightCell * reusableCell(int index, int type) override { return m_cells + index; }
+  int reusableCellCount(int type) override { return k_numberOfCells; }
+  int typeAtLocation(int i, int j) override { return 0; }
+private:
+  constexpr static int k_numberOfCells = 24;
+  int m_numberOfRows;
+  KDCoordinate m_heights[k_maxNumberOfRows];
+  HighlightCell m_cells[k_numberOfCells];
+};
+
+typedef VariableHeightList<ListViewDataSource> LinearList;
+typedef VariableHeightList<MemoizedListViewDataSource> MemoizedList;
+
+void assert_memoized_list_is_consistent(LinearList * linear, MemoizedList * memoized) {
+  int n = linear->numberOfRows();
+  quiz_assert(memoized->numberOfRows() == n);
+  /* Query the offsets from the bottom so that rows are memoized by the search
+   * before their cumulated heights are asked for. */
+  KDCoordinate totalHeight = linear->cumulatedHeightFromIndex(n);
+  for (int offset = totalHeight + 5; offset >= -1; offset--) {
+    quiz_assert(memoized->indexFromCumulatedHeight(offset) == linear->indexFromCumulatedHeight(offset));
+  }
+  for (int j = n + 1; j >= 0; j--) {
+    quiz_assert(memoized->cumulatedHeightFromIndex(j) == linear->cumulatedHeightFromIndex(j));
+  }
+}
+
+QUIZ_CASE(escher_memoized_list_view_data_source) {
+  const int numbersOfRows[] = {0, 1, 2, 7, 64, 200, MemoizedList::k_memoizedRowsCount, LinearList::k_maxNumberOfRows};
+  for (int n : numbersOfRows) {
+    LinearList linear(n);
+    MemoizedList memoized(n);
+    assert_memoized_list_is_consistent(&linear, &memoized);
+    if (n < 2) {
+      continue;
+    }
+    // Change the height of memoized rows
+    for (int j = 0; j < n; j += 7) {
+      linear.setRowHeight(j, 3 + j % 41);
+      memoized.setRowHeight(j, 3 + j % 41);
+      memoized.memoizedRowHeightDidChange(j);
+    }
+    assert_memoized_list_is_consistent(&linear, &memoized);
+    // Remove rows without reloading
+    linear.setNumberOfRows(n/2);
+    memoized.setNumberOfRows(n/2);
+    assert_memoized_list_is_consistent(&linear, &memoized);
+    // Add rows back
+    linear.setNumberOfRows(n);
+    memoized.setNumberOfRows(n);
+    linear.setRowHeight(n - 1, 50);
+    memoized.setRowHeight(n - 1, 50);
+    assert_memoized_list_is_consistent(&linear, &memoized);
+    // Change all heights and reset the memoization
+    for (int j = 0; j < n; j++) {
+      linear.setRowHeight(j, 20 - j % 3);
+      memoized.setRowHeight(j, 20 - j % 3);
+    }
+    memoized.resetMemoizedHeights();
+    assert_memoized_list_is_consistent(&linear, &memoized);
+  }
+}
+
+template<typename T>
+int scroll_through_list(T * list) {
+  /* Scroll a 200-row list from top to bottom one row at a time, laying the
+   * table out at each step, as selecting the rows does. */
+  ScrollViewDataSource scrollDataSource;
+  TableView tableView(list, &scrollDataSource);
+  tableView.setFrame(KDRect(0, 0, 320, 222), false);
+  int firstDisplayedRows = 0;
+  for (int j = 0; j < list->numberOfRows(); j++) {
+    tableView.scrollToCell(0, j);
+    firstDisplayedRows += tableView.firstDisplayedRowIndex();
+  }
+  for (int j = list->numberOfRows() - 1; j >= 0; j--) {
+    tableView.scrollToCell(0, j);
+    firstDisplayedRows += tableView.firstDisplayedRowIndex();
+  }
+  return firstDisplayedRows;
+}
+
+QUIZ_CASE(escher_memoized_list_view_data_source_scroll_benchmark) {
+  /* The first lap sums the row heights at each query, the second one uses the
+   * memoized heights. */
+  constexpr int k_numberOfRows = 200;
+  LinearList linear(k_numberOfRows);
+  MemoizedList memoized(k_numberOfRows);
+  uint64_t startTime = quiz_stopwatch_start();
+  int linearResult = scroll_through_list(&linear);
+  quiz_stopwatch_print_lap(startTime);
+  startTime = quiz_stopwatch_start();
+  int memoizedResult = scroll_through_list(&memoized);
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(linearResult == memoizedResult && linearResult > 0);
+}
@@ -34,6 +34,8 @@ public:
   bool isKeyboardEvent() const { return m_id < 4*PageSize; }
   bool isSpecialEvent() const { return m_id >= 4*PageSize; }
   bool isDefined() const;
+  // Holding the key of a repeatable event repeats it
+  bool isRepeatable() const;
   static constexpr int PageSize = Keyboard::NumberOfKeys;
 private:
   const char * defaultText() const;
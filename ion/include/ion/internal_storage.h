@@ -90,6 +90,12 @@ public:
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
   Record::ErrorStatus notifyFullnessToDelegate() const;
+  /* The generation is incremented at each change notification. Data decoded
+   * from records remain valid as long as the generation is unchanged. */
+  uint32_t generation() const { return m_generation; }
+  /* Records edited in place, through the data of their value, do not notify
+   * the delegate: their editor increments the generation instead. */
+  void recordValueDidChangeInPlace() const { m_generation++; }
 
   int numberOfRecordsWithExtension(const char * extension);
   static bool FullNameHasExtension(const char * fullName, const char * extension, size_t extensionLength);
@@ -178,6 +184,7 @@ private:
 protected:
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  mutable uint32_t m_generation;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
@@ -60,6 +60,18 @@ bool Event::isDefined() const  {
   }
 }
 
+bool Event::isRepeatable() const {
+  return *this == Left
+    || *this == Up
+    || *this == Down
+    || *this == Right
+    || *this == Backspace
+    || *this == ShiftLeft
+    || *this == ShiftRight
+    || *this == ShiftUp
+    || *this == ShiftDown;
+}
+
 const char * Event::defaultText() const {
   /* As the ExternalText event is only available on the simulator, we save a
    * comparison by not handling it on the device. */
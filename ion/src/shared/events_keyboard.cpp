@@ -27,18 +27,6 @@ int sEventRepetitionCount = 0;
 constexpr int delayBeforeRepeat = 200;
 constexpr int delayBetweenRepeat = 50;
 
-static bool canRepeatEvent(Event e) {
-  return e == Events::Left
-    || e == Events::Up
-    || e == Events::Down
-    || e == Events::Right
-    || e == Events::Backspace
-    || e == Events::ShiftLeft
-    || e == Events::ShiftRight
-    || e == Events::ShiftUp
-    || e == Events::ShiftDown;
-}
-
 Event getPlatformEvent();
 
 void ComputeAndSetRepetitionFactor(int eventRepetitionCount) {
@@ -121,9 +109,17 @@ static inline Event innerGetEvent(int * timeout) {
     }
     time += 10;
 
+    if (sEventIsRepeating && state != sLastKeyboardState) {
+      /* The repeated key was released: return at once, so that the run loop
+       * draws the frames it skipped while the key was held. */
+      sEventIsRepeating = false;
+      resetLongRepetition();
+      return Events::None;
+    }
+
     // At this point, we know that keysSeenTransitioningFromUpToDown has *always* been zero
     // In other words, no new key has been pressed
-    if (canRepeatEvent(sLastEvent)
+    if (sLastEvent.isRepeatable()
         && state == sLastKeyboardState
         && sLastEventShift == state.keyDown(Keyboard::Key::Shift)
         && sLastEventAlpha == (state.keyDown(Keyboard::Key::Alpha) || lock))
@@ -149,6 +149,7 @@ uint32_t InternalStorage::checksum() {
 void InternalStorage::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
+  m_generation++;
   if (m_delegate != nullptr) {
     m_delegate->storageDidChangeForRecord(record);
   }
@@ -342,6 +343,7 @@ InternalStorage::InternalStorage() {
   m_delegate = nullptr;
   m_lastRecordRetrieved = nullptr;
   m_lastRecordRetrievedPointer = nullptr;
+  m_generation = 0;
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
 }
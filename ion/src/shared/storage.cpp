@@ -64,6 +64,8 @@ bool Storage::hasRecord(Record r) {
 void Storage::destroyRecord(Record record) {
   emptyTrash();
   m_trashRecord = record;
+  // The trashed record is hidden without notifying the delegate
+  m_generation++;
 }
 
 Storage::Record Storage::recordWithExtensionAtIndex(const char * extension, int index) {
@@ -168,6 +170,7 @@ void Storage::reinsertTrash(const char * extension) {
     const char * fullName = fullNameOfRecordStarting(p);
     if (FullNameHasExtension(fullName, extension, strlen(extension))) {
       m_trashRecord = Record();
+      m_generation++;
     }
   }
 }
@@ -10,6 +10,7 @@ namespace Simulator {
 namespace Display {
 
 static SDL_Texture * sFramebufferTexture = nullptr;
+static uint64_t sUploadedBytes = 0;
 
 void init(SDL_Renderer * renderer) {
   Framebuffer::setActive(true);
@@ -30,16 +31,30 @@ void shutdown() {
 }
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect) {
-  int pitch = 0;
-  void * pixels = nullptr;
-  SDL_LockTexture(sFramebufferTexture, nullptr, &pixels, &pitch);
-  assert(pitch == sizeof(KDColor)*Ion::Display::Width);
-  memcpy(pixels, Framebuffer::address(), sizeof(KDColor)*Ion::Display::Width*Ion::Display::Height);
-  SDL_UnlockTexture(sFramebufferTexture);
+  // Only update the parts of the texture modified since the last draw
+  for (int i = 0; i < Framebuffer::numberOfDirtyRects(); i++) {
+    KDRect dirtyRect = Framebuffer::dirtyRectAtIndex(i);
+    SDL_Rect textureRect = {dirtyRect.x(), dirtyRect.y(), dirtyRect.width(), dirtyRect.height()};
+    int pitch = 0;
+    void * pixels = nullptr;
+    SDL_LockTexture(sFramebufferTexture, &textureRect, &pixels, &pitch);
+    const KDColor * source = Framebuffer::address() + dirtyRect.y()*Ion::Display::Width + dirtyRect.x();
+    size_t rowLength = sizeof(KDColor)*dirtyRect.width();
+    for (int j = 0; j < dirtyRect.height(); j++) {
+      memcpy(static_cast<char *>(pixels) + j*pitch, source + j*Ion::Display::Width, rowLength);
+    }
+    SDL_UnlockTexture(sFramebufferTexture);
+    sUploadedBytes += rowLength*dirtyRect.height();
+  }
+  Framebuffer::clearDirtyRects();
 
   SDL_RenderCopy(renderer, sFramebufferTexture, nullptr, rect);
 }
 
+uint64_t uploadedBytes() {
+  return sUploadedBytes;
+}
+
 }
 }
 }
@@ -12,6 +12,8 @@ void init(SDL_Renderer * renderer);
 void shutdown();
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect);
+// Number of bytes sent to the screen texture since init
+uint64_t uploadedBytes();
 
 }
 }
@@ -1,20 +1,54 @@
 #include "framebuffer.h"
 #include "window.h"
 #include <ion/display.h>
+#include <assert.h>
 
 /* Drawing on an SDL texture
  * In SDL2, drawing bitmap data happens through textures, whose data lives in
  * the GPU's memory. Reading data back from a texture is not possible, so we
  * simply maintain a framebuffer in RAM since Ion::Display::pullRect expects to
  * be able to read pixel data back.
- * A side effect is that we rewrite the whole texture when redrawing the screen.
- * This might not be the most efficient way since sending pixels to the GPU is
- * rather expensive.
- * This is also very useful when running headless because we can easily log the
+ * Since sending pixels to the GPU is rather expensive, we keep track of the
+ * rectangles modified since the last refresh and only rewrite these parts of
+ * the texture when redrawing the screen.
+ * The framebuffer is also very useful when running headless because we can easily log the
  * framebuffer to a PNG file. */
 
 static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
 static bool sFrameBufferActive = false;
+// KDRect has no default constructor
+struct DirtyRect {
+  KDRect rect = KDRectZero;
+};
+static DirtyRect sDirtyRects[Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects];
+static int sNumberOfDirtyRects = 0;
+
+static void markRectAsDirty(KDRect rect) {
+  rect = rect.intersectedWith(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+  if (rect.isEmpty()) {
+    return;
+  }
+  /* Merge the dirty rectangles intersecting the new one, so that they do not
+   * overlap. */
+  int i = 0;
+  while (i < sNumberOfDirtyRects) {
+    if (sDirtyRects[i].rect.intersects(rect)) {
+      rect = rect.unionedWith(sDirtyRects[i].rect);
+      sDirtyRects[i] = sDirtyRects[--sNumberOfDirtyRects];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  if (sNumberOfDirtyRects == Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects) {
+    // Merge all rectangles into a single one
+    for (int j = 0; j < sNumberOfDirtyRects; j++) {
+      rect = rect.unionedWith(sDirtyRects[j].rect);
+    }
+    sNumberOfDirtyRects = 0;
+  }
+  sDirtyRects[sNumberOfDirtyRects++].rect = rect;
+}
 
 namespace Ion {
 namespace Display {
@@ -24,6 +58,7 @@ static KDFrameBuffer sFrameBuffer = KDFrameBuffer(sPixels, KDSize(Width, Height)
 void pushRect(KDRect r, const KDColor * pixels) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+    markRectAsDirty(r);
     sFrameBuffer.pushRect(r, pixels);
   }
 }
@@ -31,6 +66,7 @@ void pushRect(KDRect r, const KDColor * pixels) {
 void pushRectUniform(KDRect r, KDColor c) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+    markRectAsDirty(r);
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -54,6 +90,24 @@ const KDColor * address() {
 
 void setActive(bool enabled) {
   sFrameBufferActive = enabled;
+  if (enabled) {
+    // The window does not hold any of the framebuffer yet
+    clearDirtyRects();
+    markRectAsDirty(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+  }
+}
+
+int numberOfDirtyRects() {
+  return sNumberOfDirtyRects;
+}
+
+KDRect dirtyRectAtIndex(int i) {
+  assert(i >= 0 && i < sNumberOfDirtyRects);
+  return sDirtyRects[i].rect;
+}
+
+void clearDirtyRects() {
+  sNumberOfDirtyRects = 0;
 }
 
 }
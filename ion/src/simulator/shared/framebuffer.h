@@ -10,6 +10,13 @@ namespace Framebuffer {
 const KDColor * address();
 void setActive(bool enabled);
 
+/* The regions of the framebuffer modified since the last refresh are tracked
+ * as a few rectangles, so that only them are sent to the window. */
+constexpr int k_maxNumberOfDirtyRects = 8;
+int numberOfDirtyRects();
+KDRect dirtyRectAtIndex(int i);
+void clearDirtyRects();
+
 }
 }
 }
@@ -1,18 +1,76 @@
 #include "journal.h"
 #include "journal/queue_journal.h"
+#include <ion/timing.h>
 #include <queue>
+#include <stdio.h>
 
 namespace Ion {
 namespace Simulator {
 namespace Journal {
 
+/* An event is popped from the replay journal once the previous one has been
+ * processed and the screen redrawn, so the time between two pops is the time
+ * spent on the previous event. The last event has been processed when the
+ * journal is found empty. */
+
+class ReplayJournal : public QueueJournal {
+public:
+  ReplayJournal() :
+    m_slowEventThreshold(0),
+    m_numberOfPoppedEvents(0),
+    m_lastEvent(Ion::Events::None),
+    m_lastPopTime(0),
+    m_lastEventIsTimed(false)
+  {}
+  void setSlowEventThreshold(int threshold) { m_slowEventThreshold = threshold; }
+  Ion::Events::Event popEvent() override {
+    uint64_t time = Ion::Timing::millis();
+    logLastEventIfSlow(time);
+    m_lastEvent = QueueJournal::popEvent();
+    m_lastPopTime = time;
+    m_lastEventIsTimed = true;
+    m_numberOfPoppedEvents++;
+    return m_lastEvent;
+  }
+  bool isEmpty() override {
+    bool empty = QueueJournal::isEmpty();
+    if (empty) {
+      logLastEventIfSlow(Ion::Timing::millis());
+    }
+    return empty;
+  }
+private:
+  void logLastEventIfSlow(uint64_t time) {
+    if (!m_lastEventIsTimed) {
+      return;
+    }
+    m_lastEventIsTimed = false;
+    if (m_slowEventThreshold > 0 && time - m_lastPopTime > static_cast<uint64_t>(m_slowEventThreshold)) {
+      fprintf(stderr, "Slow event %d (code %d): %d ms\n", m_numberOfPoppedEvents, static_cast<int>(static_cast<uint8_t>(m_lastEvent)), static_cast<int>(time - m_lastPopTime));
+    }
+  }
+  int m_slowEventThreshold;
+  int m_numberOfPoppedEvents;
+  Ion::Events::Event m_lastEvent;
+  uint64_t m_lastPopTime;
+  bool m_lastEventIsTimed;
+};
+
+static ReplayJournal * sharedReplayJournal() {
+  static ReplayJournal journal;
+  return &journal;
+}
+
 void init() {
   Events::logTo(logJournal());
 }
 
+void setSlowEventThreshold(int threshold) {
+  sharedReplayJournal()->setSlowEventThreshold(threshold);
+}
+
 Events::Journal * replayJournal() {
-  static QueueJournal journal;
-  return &journal;
+  return sharedReplayJournal();
 }
 
 Events::Journal * logJournal() {
@@ -8,6 +8,9 @@ namespace Simulator {
 namespace Journal {
 
 void init();
+/* Log to stderr the replayed events whose processing took more than threshold
+ * milliseconds. A null threshold disables the log. */
+void setSlowEventThreshold(int threshold);
 
 Ion::Events::Journal * replayJournal();
 Ion::Events::Journal * logJournal();
@@ -13,6 +13,7 @@
 #endif
 #include "store_script.h"
 #include <iostream>
+#include <stdlib.h>
 
 /* The Args class allows parsing and editing command-line arguments
  * The editing part allows us to add/remove arguments before forwarding them to
@@ -82,6 +83,10 @@ int main(int argc, char * argv[]) {
   if (stateFile) {
     StateFile::load(stateFile);
   }
+  const char * slowEventThreshold = args.pop("--slow-event-threshold");
+  if (slowEventThreshold) {
+    Journal::setSlowEventThreshold(atoi(slowEventThreshold));
+  }
 #endif
 
   if (help) {
@@ -91,6 +96,11 @@ int main(int argc, char * argv[]) {
     std::cout << "  -s, --screen-only         Disable the keyboard." << std::endl;
     std::cout << "  -v, --volatile            Disable saving and loading python scripts from file." << std::endl;
     std::cout << "  -u, --unresizable         Disable resizing the window." << std::endl;
+    std::cout << "  --frame-rate <fps>        Limit the number of screen refreshes per second." << std::endl;
+    std::cout << "  --display-statistics      Log the time to the first frame, then the frames and bytes sent to the screen per second." << std::endl;
+#if ION_SIMULATOR_FILES
+    std::cout << "  --slow-event-threshold <ms>  Log the replayed events taking longer than ms." << std::endl;
+#endif
     std::cout << "  -h, --help                Show this help menu." << std::endl;
     return 0;
   }
@@ -100,11 +110,17 @@ int main(int argc, char * argv[]) {
     bool screen_only = args.popFlag("--screen-only") || args.popFlag("-s");
     bool fullscreen =  args.popFlag("--fullscreen")  || args.popFlag("-f");
     bool unresizable = args.popFlag("--unresizable") || args.popFlag("-u");
+    const char * frameRate = args.pop("--frame-rate");
+    bool displayStatistics = args.popFlag("--display-statistics");
     Journal::init();
 #if EPSILON_TELEMETRY
     Telemetry::init();
 #endif
     Window::init(screen_only, fullscreen, unresizable);
+    if (frameRate) {
+      Window::setFrameRate(atoi(frameRate));
+    }
+    Window::setLogsStatistics(displayStatistics);
     Haptics::init();
   }
   if (!volatile_storage) {
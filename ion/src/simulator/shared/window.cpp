@@ -17,6 +17,13 @@ static SDL_Renderer * sRenderer = nullptr;
 static bool sNeedsRefresh = false;
 static SDL_Rect sScreenRect;
 static bool sScreenOnly = false;
+static uint64_t sRefreshPeriod = 0;
+static uint64_t sLastRefreshTime = 0;
+static bool sLogsStatistics = false;
+static uint64_t sStatisticsStartTime = 0;
+static uint64_t sStatisticsStartUploadedBytes = 0;
+static int sStatisticsNumberOfFrames = 0;
+static bool sFirstFrameLogged = false;
 
 bool isHeadless() {
   return sWindow == nullptr;
@@ -115,11 +122,47 @@ void setNeedsRefresh() {
   sNeedsRefresh = true;
 }
 
+void setFrameRate(int framesPerSecond) {
+  sRefreshPeriod = framesPerSecond > 0 ? 1000 / framesPerSecond : 0;
+}
+
+void setLogsStatistics(bool logsStatistics) {
+  sLogsStatistics = logsStatistics;
+  sStatisticsStartTime = Ion::Timing::millis();
+  sStatisticsStartUploadedBytes = Display::uploadedBytes();
+  sStatisticsNumberOfFrames = 0;
+}
+
+static void logStatistics(uint64_t time) {
+  uint64_t elapsedTime = time - sStatisticsStartTime;
+  if (elapsedTime < 1000) {
+    return;
+  }
+  uint64_t uploadedBytes = Display::uploadedBytes();
+  SDL_Log("%d frames/s, %d bytes/s uploaded",
+      static_cast<int>(sStatisticsNumberOfFrames * 1000 / elapsedTime),
+      static_cast<int>((uploadedBytes - sStatisticsStartUploadedBytes) * 1000 / elapsedTime));
+  sStatisticsStartTime = time;
+  sStatisticsStartUploadedBytes = uploadedBytes;
+  sStatisticsNumberOfFrames = 0;
+}
+
 void refresh() {
-  if (!sNeedsRefresh || isHeadless()) {
+  if (isHeadless()) {
+    return;
+  }
+  uint64_t time = Ion::Timing::millis();
+  if (sLogsStatistics) {
+    logStatistics(time);
+  }
+  /* When pacing the refreshes, a refresh that comes too early is postponed to
+   * a later keyboard scan. */
+  if (!sNeedsRefresh || time - sLastRefreshTime < sRefreshPeriod) {
     return;
   }
   sNeedsRefresh = false;
+  sLastRefreshTime = time;
+  sStatisticsNumberOfFrames++;
 
   #if EPSILON_SDL_SCREEN_ONLY
   Display::draw(sRenderer, &sScreenRect);
@@ -140,6 +183,12 @@ void refresh() {
 
   SDL_RenderPresent(sRenderer);
 
+  if (sLogsStatistics && !sFirstFrameLogged) {
+    // Ion::Timing::millis counts from the launch of the simulator
+    SDL_Log("First frame presented after %d ms", static_cast<int>(Ion::Timing::millis()));
+    sFirstFrameLogged = true;
+  }
+
   didRefresh();
 }
 
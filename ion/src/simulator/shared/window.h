@@ -14,6 +14,12 @@ void setNeedsRefresh();
 void refresh();
 void relayout();
 
+/* Refreshes are at most framesPerSecond per second, or as frequent as needed
+ * if framesPerSecond is 0. */
+void setFrameRate(int framesPerSecond);
+// Log the number of frames and of bytes sent to the screen every second
+void setLogsStatistics(bool logsStatistics);
+
 void didRefresh();
 
 }
@@ -15,5 +15,6 @@
 #include <kandinsky/postprocess_zoom_context.h>
 #include <kandinsky/rect.h>
 #include <kandinsky/size.h>
+#include <kandinsky/tile_context.h>
 
 #endif
@@ -27,6 +27,10 @@ public:
 
   // Line. Not anti-aliased.
   void drawLine(KDPoint p1, KDPoint p2, KDColor c);
+  /* Line spanning thickness pixels across its main direction, end points
+   * included. Each run of pixels on the same row or column is filled at once,
+   * so a horizontal or vertical line is a single fillRect. */
+  void drawThickLine(KDPoint p1, KDPoint p2, KDCoordinate thickness, KDColor c);
 
   // Circle
   void drawCircle(KDPoint c, KDCoordinate r, KDColor color);
@@ -0,0 +1,34 @@
+#ifndef KANDINSKY_TILE_CONTEXT_H
+#define KANDINSKY_TILE_CONTEXT_H
+
+#include <kandinsky/context.h>
+
+/* KDTileContext draws into a target context through a small tile of pixels
+ * kept in RAM. Reading pixels back, as blendRectWithMask does, loads the tile
+ * around them from the target. The following reads and writes within the tile
+ * then stay in RAM until the tile is flushed to the target. This turns the
+ * many small read-modify-write transfers of anti-aliased drawings into one
+ * pull and one push per tile. Drawings outside of the tile go straight to the
+ * target. */
+
+class KDTileContext : public KDContext {
+public:
+  KDTileContext(KDContext * target);
+  ~KDTileContext() { flush(); }
+  void flush();
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override;
+  void pushRectUniform(KDRect rect, KDColor color) override;
+  void pullRect(KDRect rect, KDColor * pixels) override;
+private:
+  constexpr static KDCoordinate k_tileSize = 32;
+  bool tileContains(KDRect rect) const { return !m_tileRect.isEmpty() && m_tileRect.containsRect(rect); }
+  void discardTileIntersecting(KDRect rect);
+  KDColor * tilePixelAddress(KDPoint p) { return m_tilePixels + (p.x() - m_tileRect.x()) + (p.y() - m_tileRect.y()) * m_tileRect.width(); }
+  KDContext * m_target;
+  KDRect m_tileRect;
+  bool m_tileIsDirty;
+  KDColor m_tilePixels[k_tileSize*k_tileSize];
+};
+
+#endif
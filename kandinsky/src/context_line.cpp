@@ -57,3 +57,43 @@ void KDContext::drawLine(KDPoint p1, KDPoint p2, KDColor c) {
     }
   }
 }
+
+void KDContext::drawThickLine(KDPoint p1, KDPoint p2, KDCoordinate thickness, KDColor c) {
+  /* Walk along the main direction with the same error term as drawLine. The
+   * coordinates are handled as int since twice the length of a line may not
+   * fit in a KDCoordinate. */
+  int dx = p2.x() - p1.x();
+  int dy = p2.y() - p1.y();
+  bool alongX = (dx >= 0 ? dx : -dx) >= (dy >= 0 ? dy : -dy);
+  int mainDelta = alongX ? dx : dy;
+  int crossDelta = alongX ? dy : dx;
+  int mainStep = mainDelta >= 0 ? 1 : -1;
+  int crossStep = crossDelta >= 0 ? 1 : -1;
+  int mainLength = mainDelta * mainStep;
+  int crossLength = crossDelta * crossStep;
+  int mainPosition = alongX ? p1.x() : p1.y();
+  int crossPosition = (alongX ? p1.y() : p1.x()) - thickness/2;
+
+  int runStart = mainPosition;
+  int error = mainLength;
+  for (int i = 0; i <= mainLength; i++) {
+    bool crossStepsAfter = false;
+    if (i < mainLength) {
+      error -= 2*crossLength;
+      crossStepsAfter = error <= 0;
+    }
+    if (i == mainLength || crossStepsAfter) {
+      int runMin = mainStep > 0 ? runStart : mainPosition;
+      int runLength = (mainPosition - runStart) * mainStep + 1;
+      fillRect(alongX ?
+          KDRect(runMin, crossPosition, runLength, thickness) :
+          KDRect(crossPosition, runMin, thickness, runLength), c);
+      runStart = mainPosition + mainStep;
+    }
+    if (crossStepsAfter) {
+      crossPosition += crossStep;
+      error += 2*mainLength;
+    }
+    mainPosition += mainStep;
+  }
+}
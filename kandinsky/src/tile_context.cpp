@@ -0,0 +1,78 @@
+#include <kandinsky/tile_context.h>
+#include <assert.h>
+#include <string.h>
+
+KDTileContext::KDTileContext(KDContext * target) :
+  KDContext(target->origin(), target->clippingRect()),
+  m_target(target),
+  m_tileRect(KDRectZero),
+  m_tileIsDirty(false)
+{
+}
+
+void KDTileContext::flush() {
+  if (m_tileIsDirty) {
+    m_target->pushRect(m_tileRect, m_tilePixels);
+    m_tileIsDirty = false;
+  }
+}
+
+void KDTileContext::pushRect(KDRect rect, const KDColor * pixels) {
+  if (!tileContains(rect)) {
+    discardTileIntersecting(rect);
+    m_target->pushRect(rect, pixels);
+    return;
+  }
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    memcpy(tilePixelAddress(KDPoint(rect.x(), rect.y() + j)), pixels + j * rect.width(), rect.width() * sizeof(KDColor));
+  }
+  m_tileIsDirty = true;
+}
+
+void KDTileContext::pushRectUniform(KDRect rect, KDColor color) {
+  if (!tileContains(rect)) {
+    discardTileIntersecting(rect);
+    m_target->pushRectUniform(rect, color);
+    return;
+  }
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    KDColor * pixel = tilePixelAddress(KDPoint(rect.x(), rect.y() + j));
+    for (KDCoordinate i = 0; i < rect.width(); i++) {
+      *pixel++ = color;
+    }
+  }
+  m_tileIsDirty = true;
+}
+
+void KDTileContext::pullRect(KDRect rect, KDColor * pixels) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  if (!tileContains(rect)) {
+    if (rect.width() > k_tileSize || rect.height() > k_tileSize) {
+      discardTileIntersecting(rect);
+      m_target->pullRect(rect, pixels);
+      return;
+    }
+    /* Load the tile centered on rect. The pulled rect is within the clipping
+     * rect, so the tile still contains it once clipped. */
+    flush();
+    m_tileRect = KDRect(
+        rect.x() - (k_tileSize - rect.width()) / 2,
+        rect.y() - (k_tileSize - rect.height()) / 2,
+        k_tileSize,
+        k_tileSize).intersectedWith(clippingRect());
+    assert(m_tileRect.containsRect(rect));
+    m_target->pullRect(m_tileRect, m_tilePixels);
+  }
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    memcpy(pixels + j * rect.width(), tilePixelAddress(KDPoint(rect.x(), rect.y() + j)), rect.width() * sizeof(KDColor));
+  }
+}
+
+void KDTileContext::discardTileIntersecting(KDRect rect) {
+  if (m_tileRect.intersects(rect)) {
+    flush();
+    m_tileRect = KDRectZero;
+  }
+}
@@ -0,0 +1,90 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+#include <stdlib.h>
+
+constexpr KDCoordinate k_width = 80;
+constexpr KDCoordinate k_height = 60;
+
+static bool pixels_are_colored_in(const KDColor * pixels, KDRect rect) {
+  for (int j = 0; j < k_height; j++) {
+    for (int i = 0; i < k_width; i++) {
+      bool colored = pixels[i + j * k_width] == KDColorRed;
+      if (colored != rect.contains(KDPoint(i, j))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(kandinsky_thick_line_straight) {
+  KDColor pixels[k_width*k_height];
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+
+  context.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  context.drawThickLine(KDPoint(10, 20), KDPoint(30, 20), 3, KDColorRed);
+  quiz_assert(pixels_are_colored_in(pixels, KDRect(10, 19, 21, 3)));
+
+  context.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  context.drawThickLine(KDPoint(40, 50), KDPoint(40, 30), 4, KDColorRed);
+  quiz_assert(pixels_are_colored_in(pixels, KDRect(38, 30, 4, 21)));
+
+  // A single point only spans the thickness across the line
+  context.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  context.drawThickLine(KDPoint(5, 5), KDPoint(5, 5), 2, KDColorRed);
+  quiz_assert(pixels_are_colored_in(pixels, KDRect(5, 4, 1, 2)));
+
+  // The line is clipped by the context
+  context.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  context.drawThickLine(KDPoint(-100, 2), KDPoint(200, 2), 5, KDColorRed);
+  quiz_assert(pixels_are_colored_in(pixels, KDRect(0, 0, k_width, 5)));
+}
+
+QUIZ_CASE(kandinsky_thick_line_matches_line) {
+  KDColor thinPixels[k_width*k_height];
+  KDFrameBuffer thinFrameBuffer(thinPixels, KDSize(k_width, k_height));
+  KDFrameBufferContext thinContext(&thinFrameBuffer);
+  KDColor thickPixels[k_width*k_height];
+  KDFrameBuffer thickFrameBuffer(thickPixels, KDSize(k_width, k_height));
+  KDFrameBufferContext thickContext(&thickFrameBuffer);
+
+  const KDPoint ends[][2] = {
+    {KDPoint(5, 5), KDPoint(45, 25)},
+    {KDPoint(70, 2), KDPoint(60, 55)},
+    {KDPoint(3, 50), KDPoint(50, 41)},
+    {KDPoint(10, 10), KDPoint(40, 40)}
+  };
+  for (const KDPoint * line : ends) {
+    // With a thickness of 1, drawThickLine is drawLine with its end point
+    thinContext.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+    thinContext.drawLine(line[0], line[1], KDColorRed);
+    thinContext.setPixel(line[1], KDColorRed);
+    thickContext.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+    thickContext.drawThickLine(line[0], line[1], 1, KDColorRed);
+    for (int i = 0; i < k_width*k_height; i++) {
+      quiz_assert(thinPixels[i] == thickPixels[i]);
+    }
+
+    /* A thicker line covers the same pixels, each extended across the main
+     * direction of the line. */
+    KDCoordinate thickness = 3;
+    bool alongX = abs(line[1].x() - line[0].x()) >= abs(line[1].y() - line[0].y());
+    thickContext.fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+    thickContext.drawThickLine(line[0], line[1], thickness, KDColorRed);
+    for (int j = 0; j < k_height; j++) {
+      for (int i = 0; i < k_width; i++) {
+        bool expected = false;
+        for (int k = -thickness/2; k < thickness - thickness/2; k++) {
+          int si = i - (alongX ? 0 : k);
+          int sj = j - (alongX ? k : 0);
+          if (si >= 0 && si < k_width && sj >= 0 && sj < k_height && thinPixels[si + sj * k_width] == KDColorRed) {
+            expected = true;
+          }
+        }
+        quiz_assert((thickPixels[i + j * k_width] == KDColorRed) == expected);
+      }
+    }
+  }
+}
@@ -0,0 +1,75 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+class KDCountingFrameBufferContext : public KDFrameBufferContext {
+public:
+  KDCountingFrameBufferContext(KDFrameBuffer * frameBuffer) :
+    KDFrameBufferContext(frameBuffer),
+    m_numberOfPulls(0),
+    m_numberOfPushes(0)
+  {}
+  int numberOfPulls() const { return m_numberOfPulls; }
+  int numberOfPushes() const { return m_numberOfPushes; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor * pixels) override {
+    m_numberOfPulls++;
+    KDFrameBufferContext::pullRect(rect, pixels);
+  }
+private:
+  int m_numberOfPulls;
+  int m_numberOfPushes;
+};
+
+constexpr KDCoordinate k_width = 100;
+constexpr KDCoordinate k_height = 60;
+
+void draw_scene(KDContext * ctx) {
+  constexpr KDCoordinate stampSize = 3;
+  const uint8_t stampMask[stampSize*stampSize] = {
+    0xC0, 0x40, 0xC0,
+    0x40, 0x00, 0x40,
+    0xC0, 0x40, 0xC0
+  };
+  KDColor workingBuffer[stampSize*stampSize];
+  ctx->fillRect(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  ctx->fillRect(KDRect(0, 30, k_width, 1), KDColorBlack);
+  // Anti-aliased stamps along curves, crossing the edges of the view
+  for (int i = -5; i < k_width + 5; i++) {
+    ctx->blendRectWithMask(KDRect(i, (i - 50) * (i - 50) / 40 - 5, stampSize, stampSize), KDColorRed, stampMask, workingBuffer);
+  }
+  for (int i = -5; i < k_width + 5; i++) {
+    ctx->blendRectWithMask(KDRect(i, 20 + i / 3, stampSize, stampSize), KDColorBlue, stampMask, workingBuffer);
+  }
+  ctx->drawString("1.5", KDPoint(40, 32), KDFont::SmallFont, KDColorBlack, KDColorWhite);
+  ctx->blendRectWithMask(KDRect(41, 33, stampSize, stampSize), KDColorGreen, stampMask, workingBuffer);
+}
+
+QUIZ_CASE(kandinsky_tile_context) {
+  KDColor directPixels[k_width*k_height];
+  KDFrameBuffer directFrameBuffer(directPixels, KDSize(k_width, k_height));
+  KDCountingFrameBufferContext directContext(&directFrameBuffer);
+  draw_scene(&directContext);
+
+  KDColor tiledPixels[k_width*k_height];
+  KDFrameBuffer tiledFrameBuffer(tiledPixels, KDSize(k_width, k_height));
+  KDCountingFrameBufferContext tiledTargetContext(&tiledFrameBuffer);
+  {
+    KDTileContext tileContext(&tiledTargetContext);
+    draw_scene(&tileContext);
+  }
+
+  for (int i = 0; i < k_width*k_height; i++) {
+    quiz_assert(directPixels[i] == tiledPixels[i]);
+  }
+  quiz_assert(tiledTargetContext.numberOfPulls() * 5 < directContext.numberOfPulls());
+  quiz_assert(tiledTargetContext.numberOfPushes() * 5 < directContext.numberOfPushes());
+}
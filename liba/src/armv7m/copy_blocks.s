@@ -0,0 +1,21 @@
+.syntax unified
+
+.section .text.liba_copy_blocks
+.align 2
+.thumb
+.global liba_copy_blocks
+liba_copy_blocks:
+  /* r0 = dst, r1 = src, r2 = numberOfBlocks
+   * Each block of 8 words is loaded in r3-r10 with a single LDM and stored
+   * with a single STM. */
+  cbz r2, 2f
+  push {r4-r10}
+1:
+  ldmia r1!, {r3-r10}
+  stmia r0!, {r3-r10}
+  subs r2, r2, #1
+  bne 1b
+  pop {r4-r10}
+2:
+  bx lr
+.type liba_copy_blocks, function
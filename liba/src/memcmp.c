@@ -1,8 +1,25 @@
 #include <string.h>
+#include "word.h"
 
 int memcmp(const void * s1, const void * s2, size_t n) {
-  char * source1 = (char *)s1;
-  char * source2 = (char *)s2;
+  const unsigned char * source1 = (const unsigned char *)s1;
+  const unsigned char * source2 = (const unsigned char *)s2;
+  if (liba_are_mutually_aligned(source1, source2)) {
+    while (n > 0 && !liba_is_word_aligned(source1)) {
+      if (*source1 != *source2) {
+        return *source1 - *source2;
+      }
+      source1++;
+      source2++;
+      n--;
+    }
+    // Skip the equal words, the first different one is compared bytewise
+    while (n >= LIBA_WORD_SIZE && *(const liba_word_t *)source1 == *(const liba_word_t *)source2) {
+      source1 += LIBA_WORD_SIZE;
+      source2 += LIBA_WORD_SIZE;
+      n -= LIBA_WORD_SIZE;
+    }
+  }
   while (n--) {
     if (*source1 != *source2) {
       return *source1 - *source2;
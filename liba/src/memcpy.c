@@ -1,4 +1,5 @@
 #include <string.h>
+#include "word.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memcpy(void * dst, const void * src, size_t n) __attribute__((externally_visible));
@@ -7,6 +8,25 @@ void * __attribute__((noinline)) memcpy(void * dst, const void * src, size_t n)
   char * destination = (char *)dst;
   char * source = (char *)src;
 
+  if (liba_are_mutually_aligned(destination, source)) {
+    // Copy the head bytes, then blocks and words, then the tail bytes
+    while (n > 0 && !liba_is_word_aligned(destination)) {
+      *destination++ = *source++;
+      n--;
+    }
+    size_t numberOfBlocks = n / LIBA_BLOCK_SIZE;
+    liba_copy_blocks(destination, source, numberOfBlocks);
+    destination += numberOfBlocks * LIBA_BLOCK_SIZE;
+    source += numberOfBlocks * LIBA_BLOCK_SIZE;
+    n -= numberOfBlocks * LIBA_BLOCK_SIZE;
+    while (n >= LIBA_WORD_SIZE) {
+      *(liba_word_t *)destination = *(liba_word_t *)source;
+      destination += LIBA_WORD_SIZE;
+      source += LIBA_WORD_SIZE;
+      n -= LIBA_WORD_SIZE;
+    }
+  }
+
   while (n--) {
     *destination++ = *source++;
   }
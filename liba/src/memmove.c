@@ -1,4 +1,5 @@
 #include <string.h>
+#include "word.h"
 
 void * memmove(void * dst, const void * src, size_t n) {
   char * destination = (char *)dst;
@@ -8,10 +9,36 @@ void * memmove(void * dst, const void * src, size_t n) {
     /* Copy backwards to avoid overwrites */
     source += n;
     destination += n;
+    if (liba_are_mutually_aligned(destination, source)) {
+      while (n > 0 && !liba_is_word_aligned(destination)) {
+        *--destination = *--source;
+        n--;
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        destination -= LIBA_WORD_SIZE;
+        source -= LIBA_WORD_SIZE;
+        *(liba_word_t *)destination = *(liba_word_t *)source;
+        n -= LIBA_WORD_SIZE;
+      }
+    }
     while (n--) {
       *--destination = *--source;
     }
   } else {
+    /* Copy forwards. When the buffers overlap, each word is read before the
+     * destination reaches it. */
+    if (liba_are_mutually_aligned(destination, source)) {
+      while (n > 0 && !liba_is_word_aligned(destination)) {
+        *destination++ = *source++;
+        n--;
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        *(liba_word_t *)destination = *(liba_word_t *)source;
+        destination += LIBA_WORD_SIZE;
+        source += LIBA_WORD_SIZE;
+        n -= LIBA_WORD_SIZE;
+      }
+    }
     while (n--) {
       *destination++ = *source++;
     }
@@ -1,10 +1,30 @@
 #include <string.h>
+#include "word.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memset(void * b, int c, size_t len) __attribute__((externally_visible));
 
 void * __attribute__((noinline)) memset(void * b, int c, size_t len) {
   char * destination = (char *)b;
+  while (len > 0 && !liba_is_word_aligned(destination)) {
+    *destination++ = (unsigned char)c;
+    len--;
+  }
+  liba_word_t pattern = (liba_word_t)0x01010101 * (unsigned char)c;
+  while (len >= 4 * LIBA_WORD_SIZE) {
+    liba_word_t * words = (liba_word_t *)destination;
+    words[0] = pattern;
+    words[1] = pattern;
+    words[2] = pattern;
+    words[3] = pattern;
+    destination += 4 * LIBA_WORD_SIZE;
+    len -= 4 * LIBA_WORD_SIZE;
+  }
+  while (len >= LIBA_WORD_SIZE) {
+    *(liba_word_t *)destination = pattern;
+    destination += LIBA_WORD_SIZE;
+    len -= LIBA_WORD_SIZE;
+  }
   while (len--) {
     *destination++ = (unsigned char)c;
   }
@@ -1,7 +1,19 @@
 #include <string.h>
+#include "word.h"
 
 size_t strlen(const char * s) {
   const char * str = s;
+  while (!liba_is_word_aligned(str)) {
+    if (*str == 0) {
+      return str - s;
+    }
+    str++;
+  }
+  /* An aligned word never crosses a page or a memory region boundary, so the
+   * bytes after the terminating null byte can be read. */
+  while (!liba_word_has_zero_byte(*(const liba_word_t *)str)) {
+    str += LIBA_WORD_SIZE;
+  }
   while (*str)
     str++;
   return str - s;
@@ -0,0 +1,52 @@
+#ifndef LIBA_WORD_H
+#define LIBA_WORD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Memory and string functions process the bytes of word-aligned buffers one
+ * word at a time, and copy large buffers by blocks of several words. Words
+ * are accessed through a may_alias type, so that the compiler does not assume
+ * that they do not overlap the bytes they are made of. */
+
+typedef uint32_t __attribute__((__may_alias__)) liba_word_t;
+
+#define LIBA_WORD_SIZE (sizeof(liba_word_t))
+#define LIBA_BLOCK_SIZE (8 * LIBA_WORD_SIZE)
+
+static inline int liba_is_word_aligned(const void * p) {
+  return ((uintptr_t)p & (LIBA_WORD_SIZE - 1)) == 0;
+}
+
+static inline int liba_are_mutually_aligned(const void * p1, const void * p2) {
+  return (((uintptr_t)p1 ^ (uintptr_t)p2) & (LIBA_WORD_SIZE - 1)) == 0;
+}
+
+// Non-zero if and only if one of the bytes of w is zero
+static inline liba_word_t liba_word_has_zero_byte(liba_word_t w) {
+  return (w - (liba_word_t)0x01010101) & ~w & (liba_word_t)0x80808080;
+}
+
+/* liba_copy_blocks copies numberOfBlocks blocks of LIBA_BLOCK_SIZE bytes
+ * between word-aligned buffers. Each block is entirely read before being
+ * written, so the copy is also correct when dst is before an overlapping src.
+ * On ARM, it is implemented with LDM/STM in armv7m/copy_blocks.s. */
+
+#if __arm__
+void liba_copy_blocks(void * dst, const void * src, size_t numberOfBlocks);
+#else
+static inline void liba_copy_blocks(void * dst, const void * src, size_t numberOfBlocks) {
+  liba_word_t * destination = (liba_word_t *)dst;
+  const liba_word_t * source = (const liba_word_t *)src;
+  while (numberOfBlocks--) {
+    liba_word_t w0 = source[0], w1 = source[1], w2 = source[2], w3 = source[3];
+    liba_word_t w4 = source[4], w5 = source[5], w6 = source[6], w7 = source[7];
+    destination[0] = w0; destination[1] = w1; destination[2] = w2; destination[3] = w3;
+    destination[4] = w4; destination[5] = w5; destination[6] = w6; destination[7] = w7;
+    source += 8;
+    destination += 8;
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef LIBA_TEST_PREFIX_H
+#define LIBA_TEST_PREFIX_H
+
+/* On platforms linked with the system libc, liba is not built. Its memory and
+ * string functions are still compiled in the test runner, along with their
+ * tests, under a liba_ prefix that keeps them apart from the libc ones. This
+ * header is force-included in these sources, once the libc declarations have
+ * been read. */
+
+#include <string.h>
+
+#define memcmp liba_memcmp
+#define memcpy liba_memcpy
+#define memmove liba_memmove
+#define memset liba_memset
+#define strlen liba_strlen
+
+int memcmp(const void * s1, const void * s2, size_t n);
+void * memcpy(void * dst, const void * src, size_t n);
+void * memmove(void * dst, const void * src, size_t n);
+void * memset(void * b, int c, size_t len);
+size_t strlen(const char * s);
+
+#endif
@@ -0,0 +1,133 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <string.h>
+#include <stdint.h>
+
+#define BUFFER_SIZE 300
+
+/* The memory functions are compared to byte loops on every size up to a few
+ * blocks of words, and on every relative alignment of their buffers. */
+
+static void fill_buffer(char * buffer, size_t size, int seed) {
+  for (size_t i = 0; i < size; i++) {
+    buffer[i] = (char)(seed + 37 * i + (i >> 3));
+  }
+}
+
+static int buffers_are_equal(const char * b1, const char * b2, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    if (b1[i] != b2[i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+QUIZ_CASE(liba_memcpy_memset) {
+  char source[BUFFER_SIZE];
+  char result[BUFFER_SIZE];
+  char expected[BUFFER_SIZE];
+  fill_buffer(source, BUFFER_SIZE, 1);
+  for (size_t srcOffset = 0; srcOffset < 4; srcOffset++) {
+    for (size_t dstOffset = 0; dstOffset < 4; dstOffset++) {
+      for (size_t n = 0; n < 100; n++) {
+        fill_buffer(result, BUFFER_SIZE, 2);
+        fill_buffer(expected, BUFFER_SIZE, 2);
+        for (size_t i = 0; i < n; i++) {
+          expected[dstOffset + i] = source[srcOffset + i];
+        }
+        quiz_assert(memcpy(result + dstOffset, source + srcOffset, n) == result + dstOffset);
+        quiz_assert(buffers_are_equal(result, expected, BUFFER_SIZE));
+
+        for (size_t i = 0; i < n; i++) {
+          expected[dstOffset + i] = (char)0xA5;
+        }
+        quiz_assert(memset(result + dstOffset, 0xA5, n) == result + dstOffset);
+        quiz_assert(buffers_are_equal(result, expected, BUFFER_SIZE));
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_memmove) {
+  char result[BUFFER_SIZE];
+  char expected[BUFFER_SIZE];
+  for (size_t srcOffset = 0; srcOffset < 80; srcOffset += 3) {
+    for (size_t dstOffset = 0; dstOffset < 80; dstOffset += 5) {
+      for (size_t n = 0; n < 110; n += 7) {
+        fill_buffer(result, BUFFER_SIZE, 3);
+        fill_buffer(expected, BUFFER_SIZE, 3);
+        char copy[BUFFER_SIZE];
+        for (size_t i = 0; i < n; i++) {
+          copy[i] = expected[srcOffset + i];
+        }
+        for (size_t i = 0; i < n; i++) {
+          expected[dstOffset + i] = copy[i];
+        }
+        quiz_assert(memmove(result + dstOffset, result + srcOffset, n) == result + dstOffset);
+        quiz_assert(buffers_are_equal(result, expected, BUFFER_SIZE));
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_memcmp_strlen) {
+  char s1[BUFFER_SIZE];
+  char s2[BUFFER_SIZE];
+  for (size_t offset1 = 0; offset1 < 4; offset1++) {
+    for (size_t offset2 = 0; offset2 < 4; offset2++) {
+      for (size_t n = 0; n < 70; n++) {
+        fill_buffer(s1, BUFFER_SIZE, 4);
+        for (size_t i = 0; i < n; i++) {
+          s2[offset2 + i] = s1[offset1 + i];
+        }
+        quiz_assert(memcmp(s1 + offset1, s2 + offset2, n) == 0);
+        for (size_t i = 0; i < n; i++) {
+          s2[offset2 + i] = (char)(s2[offset2 + i] + 1);
+          // The bytes are compared as unsigned char, only the sign matters
+          int difference = (unsigned char)s1[offset1 + i] - (unsigned char)s2[offset2 + i];
+          int result = memcmp(s1 + offset1, s2 + offset2, n);
+          quiz_assert((result < 0) == (difference < 0) && (result > 0) == (difference > 0));
+          s2[offset2 + i] = (char)(s2[offset2 + i] - 1);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+          s1[offset1 + i] = (char)('a' + i % 26);
+        }
+        s1[offset1 + n] = 0;
+        quiz_assert(strlen(s1 + offset1) == n);
+      }
+    }
+  }
+}
+
+static void __attribute__((noinline)) byte_copy(char * destination, const char * source, size_t n) {
+  while (n--) {
+    *destination++ = *(volatile const char *)source++;
+  }
+}
+
+QUIZ_CASE(liba_memcpy_benchmark) {
+  /* For each size and relative alignment, the first lap copies byte by byte
+   * and the second one uses memcpy. */
+  static char source[4096 + 4];
+  static char destination[4096 + 4];
+  const size_t sizes[] = {16, 256, 4096};
+  const size_t offsets[] = {0, 1, 3};
+  for (size_t i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+    for (size_t j = 0; j < sizeof(offsets)/sizeof(offsets[0]); j++) {
+      size_t n = sizes[i];
+      int numberOfCopies = (1 << 20) / n;
+      uint64_t startTime = quiz_stopwatch_start();
+      for (int k = 0; k < numberOfCopies; k++) {
+        byte_copy(destination + offsets[j], source, n);
+      }
+      quiz_stopwatch_print_lap(startTime);
+      startTime = quiz_stopwatch_start();
+      for (int k = 0; k < numberOfCopies; k++) {
+        memcpy(destination + offsets[j], source, n);
+      }
+      quiz_stopwatch_print_lap(startTime);
+    }
+  }
+}
@@ -25,8 +25,8 @@ public:
   Expression setSign(Sign s, ReductionContext reductionContext) override;
 
   // Approximation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-    return Complex<T>::Builder(std::abs(c));
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+    return std::complex<T>(std::abs(c));
   }
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<float>(this, approximationContext, computeOnComplex<float>);
@@ -34,6 +34,12 @@ public:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapScalar<float>(this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapScalar<double>(this, approximationContext, computeOnComplex<double>, result);
+  }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -29,7 +29,7 @@ public:
   int getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[], ExpressionNode::SymbolicComputation symbolicComputation) const override;
 
   // Evaluation
-  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return Complex<T>::Builder(c+d); }
+  template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return c+d; }
   template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::ElementWiseOnComplexMatrices(m, n, complexFormat, compute<T>);
   }
@@ -71,6 +71,12 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::MapReduce<double>(this, approximationContext, compute<double>, computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>, computeOnMatrices<double>);
    }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapReduceScalar<float>(this, approximationContext, compute<float>, result);
+  }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapReduceScalar<double>(this, approximationContext, compute<double>, result);
+  }
 };
 
 class Addition final : public NAryExpression {
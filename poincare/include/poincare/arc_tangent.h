@@ -34,13 +34,19 @@ private:
   LayoutShape rightLayoutShape() const override { return LayoutShape::BoundaryPunctuation; }
 
   //Evaluation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<float>(this, approximationContext, computeOnComplex<float>);
   }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapScalar<float>(this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapScalar<double>(this, approximationContext, computeOnComplex<double>, result);
+  }
 };
 
 class ArcTangent final : public Expression {
@@ -36,6 +36,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { *result = ComplexNode<float>::Record(templatedApproximate<float>()); return true; }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { *result = ComplexNode<double>::Record(templatedApproximate<double>()); return true; }
   template<typename T> T templatedApproximate() const;
 
 private:
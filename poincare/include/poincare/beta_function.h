@@ -31,6 +31,8 @@
 namespace Poincare {
 
 double BetaFunction(double a, double b);
+// ln(B(a,b)), for a and b positive
+double LnBetaFunction(double a, double b);
 
 }
 
@@ -17,7 +17,6 @@ public:
   // LayoutNode
   void moveCursorLeft(LayoutCursor * cursor, bool * shouldRecomputeLayout, bool forSelection) override;
   void moveCursorRight(LayoutCursor * cursor, bool * shouldRecomputeLayout, bool forSelection) override;
-  void invalidAllSizesPositionsAndBaselines() override;
 
   // TreeNode
   size_t size() const override { return sizeof(BracketLayoutNode); }
@@ -30,6 +29,9 @@ protected:
   // LayoutNode
   KDCoordinate computeBaseline() override;
   KDPoint positionOfChild(LayoutNode * child) override;
+  void invalidSizeAndBaseline() override;
+  // The height of a bracket depends on the layouts it encloses
+  bool sizeDependsOnSiblings() const override { return true; }
   KDCoordinate childHeight();
   KDCoordinate computeChildHeight();
   bool m_childHeightComputed;
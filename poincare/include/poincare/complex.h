@@ -12,6 +12,11 @@ template<typename T>
 class ComplexNode final : public EvaluationNode<T>, public std::complex<T> {
 public:
   ComplexNode(std::complex<T> c);
+  /* Flag the approximation as having encountered a complex if c is not real,
+   * and return c with its signed zeros made positive. Each complex built
+   * during an approximation goes through it, be it stored in the pool or on
+   * the stack. */
+  static std::complex<T> Record(std::complex<T> c);
 
   // TreeNode
   size_t size() const override { return sizeof(ComplexNode<T>); }
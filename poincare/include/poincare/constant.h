@@ -1,6 +1,7 @@
 #ifndef POINCARE_CONSTANT_H
 #define POINCARE_CONSTANT_H
 
+#include <poincare/complex.h>
 #include <poincare/symbol_abstract.h>
 
 namespace Poincare {
@@ -34,8 +35,10 @@ public:
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
 
   /* Approximation */
-  Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(); }
-  Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(); }
+  Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
+  Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { *result = ComplexNode<float>::Record(templatedApproximate<float>()); return true; }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { *result = ComplexNode<double>::Record(templatedApproximate<double>()); return true; }
 
   /* Symbol properties */
   bool isPi() const { return isConstantCodePoint(UCodePointGreekSmallLetterPi); }
@@ -57,7 +60,7 @@ private:
   char m_name[0]; // MUST be the last member variable
 
   size_t nodeSize() const override { return sizeof(ConstantNode); }
-  template<typename T> Evaluation<T> templatedApproximate() const;
+  template<typename T> std::complex<T> templatedApproximate() const;
   bool isConstantCodePoint(CodePoint c) const;
 };
 
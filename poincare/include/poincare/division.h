@@ -45,6 +45,12 @@ public:
         computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>,
         computeOnMatrices<double>);
   }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapReduceScalar<float>(this, approximationContext, compute<float>, result);
+  }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapReduceScalar<double>(this, approximationContext, compute<double>, result);
+  }
 
   // Layout
   bool childNeedsSystemParenthesesAtSerialization(const TreeNode * child) const override;
@@ -57,7 +63,7 @@ public:
 
 private:
   // Approximation
-  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
+  template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
   template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(m, c, complexFormat, compute<T>);
   }
@@ -28,7 +28,12 @@ public:
   Color color() const { return m_color; }
   void setColor(Color color) { m_color = color; }
   bool isVisible() const { return m_isVisible; }
-  void setVisible(bool visible) { m_isVisible = visible; }
+  void setVisible(bool visible) {
+    if (visible != m_isVisible) {
+      m_isVisible = visible;
+      invalidSizesPositionsAndBaselinesAfterEdit();
+    }
+  }
 
   // LayoutNode
   void deleteBeforeCursor(LayoutCursor * cursor) override;
@@ -0,0 +1,72 @@
+#ifndef POINCARE_ENCLOSURE_H
+#define POINCARE_ENCLOSURE_H
+
+#include <poincare/expression.h>
+#include <poincare/preferences.h>
+#include <cmath>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* An Enclosure bounds the values taken by an expression of one real variable
+ * when this variable spans an interval, using interval arithmetic: each node
+ * of the expression maps the enclosures of its children to an enclosure of
+ * its own values, rounded outwards. The bounds are thus guaranteed, but may be
+ * loose, as the correlations between the children are ignored (x-x is
+ * enclosed by [-1,1] for x in [0,1]).
+ * The enclosure is computed on the tree, without any context nor any
+ * allocation in the pool: it is meant for reduced expressions, whose symbols
+ * other than the variable have been replaced. Nodes that cannot be enclosed
+ * make the whole enclosure Unknown, and the caller has to fall back on
+ * approximations. */
+
+class Enclosure {
+public:
+  enum class Status : uint8_t {
+    Defined,       // The expression is defined on the whole interval
+    PartlyDefined, // The expression may be undefined on part of the interval
+    Undefined,     // The expression is undefined on the whole interval
+    Unknown        // The expression could not be enclosed
+  };
+
+  Enclosure(double min, double max, Status status = Status::Defined);
+  static Enclosure Undefined() { return Enclosure(NAN, NAN, Status::Undefined); }
+  static Enclosure Unknown() { return Enclosure(NAN, NAN, Status::Unknown); }
+
+  /* Enclose the values of e when the variable named symbol spans [xMin, xMax]
+   * (in radians or not, depending on angleUnit). */
+  static Enclosure ForExpression(const Expression e, const char * symbol, double xMin, double xMax, Preferences::AngleUnit angleUnit);
+
+  Status status() const { return m_status; }
+  // The bounds are only relevant if the status is Defined or PartlyDefined
+  double min() const { return m_min; }
+  double max() const { return m_max; }
+  bool isDefined() const { return m_status == Status::Defined; }
+  bool isBounded() const { return !std::isinf(m_min) && !std::isinf(m_max); }
+  bool contains(double value) const { return m_min <= value && value <= m_max; }
+
+private:
+  static Enclosure Enclose(const Expression e, const char * symbol, double xMin, double xMax, double angleFactor);
+  static Enclosure Add(Enclosure a, Enclosure b);
+  static Enclosure Multiply(Enclosure a, Enclosure b);
+  static Enclosure Opposite(Enclosure a);
+  static Enclosure Inverse(Enclosure a);
+  static Enclosure IntegerPower(Enclosure a, int n);
+  static Enclosure Power(Enclosure a, Enclosure b, bool evenRootExponent);
+  static Enclosure Exponential(Enclosure a);
+  static Enclosure Logarithm(Enclosure a, double (*logarithm)(double));
+  static Enclosure SquareRoot(Enclosure a);
+  static Enclosure AbsoluteValue(Enclosure a);
+  static Enclosure SineOrCosine(Enclosure a, bool cosine);
+  static Enclosure Tangent(Enclosure a);
+  // The status of an operation on enclosures with the given statuses
+  static Status CombinedStatus(Status s1, Status s2);
+
+  double m_min;
+  double m_max;
+  Status m_status;
+};
+
+}
+
+#endif
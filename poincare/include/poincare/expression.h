@@ -43,6 +43,7 @@ class Expression : public TreeHandle {
   friend class Division;
   friend class DivisionQuotient;
   friend class DivisionRemainder;
+  friend class Enclosure;
   friend class Equal;
   friend class Factor;
   friend class Factorial;
@@ -136,6 +137,9 @@ public:
   Expression clone() const;
   static Expression Parse(char const * string, Context * context, bool addMissingParenthesis = true);
   static Expression ExpressionFromAddress(const void * address, size_t size, const void * record=nullptr);
+  /* Copies a tree previously saved from addressInPool() and size(), whatever
+   * the format of the expressions stored in records */
+  static Expression ExpressionFromTreeAddress(const void * address, size_t size);
 
   /* Circuit breaker */
   typedef bool (*CircuitBreaker)();
@@ -270,6 +274,7 @@ public:
   Coordinate2D<double> nextMinimum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   Coordinate2D<double> nextMaximum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   double nextRoot(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  int roots(const char * symbol, double start, double step, double max, double * roots, int maxNumberOfRoots, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   Coordinate2D<double> nextIntersection(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const;
 
   /* This class is meant to contain data about named functions (e.g. sin, tan...)
@@ -281,7 +286,7 @@ public:
       m_name(name),
       m_numberOfChildren(numberOfChildren),
       m_untypedBuilder(builder) {}
-    const char * name() const { return m_name; }
+    constexpr const char * name() const { return m_name; }
     int numberOfChildren() const { return m_numberOfChildren; }
     Expression build(Expression children) const { return (*m_untypedBuilder)(children); }
   private:
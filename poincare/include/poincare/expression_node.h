@@ -286,6 +286,13 @@ public:
   constexpr static int k_maxNumberOfSteps = 10000;
   virtual Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const = 0;
   virtual Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const = 0;
+  /* approximateScalar approximates the expression in result without building
+   * any Evaluation in the pool. It returns false if the approximation is not
+   * a scalar (a matrix for instance), in which case approximate has to be
+   * used instead. By default, it falls back on approximate: only the nodes
+   * that are evaluated in loops (when plotting or solving) override it. */
+  virtual bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const { return templatedApproximateScalarWithEvaluation<float>(approximationContext, result); }
+  virtual bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const { return templatedApproximateScalarWithEvaluation<double>(approximationContext, result); }
 
   /* Simplification */
   /*!*/ virtual void deepReduceChildren(ReductionContext reductionContext);
@@ -326,6 +333,8 @@ protected:
   /* Hierarchy */
   ExpressionNode * parent() const override { return static_cast<ExpressionNode *>(TreeNode::parent()); }
   Direct<ExpressionNode> children() const { return Direct<ExpressionNode>(this); }
+private:
+  template<typename T> bool templatedApproximateScalarWithEvaluation(ApproximationContext approximationContext, std::complex<T> * result) const;
 };
 
 }
@@ -49,6 +49,8 @@ public:
   /* Evaluation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { *result = ComplexNode<float>::Record((float)m_value); return true; }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { *result = ComplexNode<double>::Record((double)m_value); return true; }
 private:
   // Simplification
   LayoutShape leftLayoutShape() const override { return LayoutShape::Decimal; }
@@ -76,8 +76,7 @@ public:
   // Constructors
   HorizontalLayout(HorizontalLayoutNode * n) : Layout(n) {}
 
-  // FIXME: use Layout instead of TreeHandle
-  static HorizontalLayout Builder(std::initializer_list<TreeHandle> children = {}) { return TreeHandle::NAryBuilder<HorizontalLayout,HorizontalLayoutNode>(children); }
+  static HorizontalLayout Builder(std::initializer_list<Layout> children = {});
   // TODO: Get rid of those helpers
   static HorizontalLayout Builder(Layout l) { return Builder({l}); }
   static HorizontalLayout Builder(Layout l1, Layout l2) { return Builder({l1, l2}); }
@@ -11,7 +11,15 @@ namespace Poincare {
 class LayoutCursor;
 class Expression;
 
-class Layout : public TreeHandle {
+/* Layout does not derive publicly from TreeHandle: a layout cannot be used as
+ * a TreeHandle outside of the layout classes, so that its in-place hierarchy
+ * operations, which discard the metrics of the edited layouts, cannot be
+ * bypassed by calling those of TreeHandle through a base reference. */
+
+class Layout : protected TreeHandle {
+  friend class TreeHandle;
+  friend class TreeNode;
+  friend class TreePool;
   friend class GridLayoutNode;
   friend class HorizontalLayoutNode;
   friend class LayoutNode;
@@ -21,6 +29,27 @@ public:
   Layout() : TreeHandle() {}
   Layout(const LayoutNode * node) : TreeHandle(node) {}
   Layout clone() const;
+
+  // TreeHandle
+  using TreeHandle::identifier;
+  using TreeHandle::wasErasedByException;
+  using TreeHandle::nodeRetainCount;
+  using TreeHandle::size;
+  using TreeHandle::addressInPool;
+  using TreeHandle::isGhost;
+  using TreeHandle::isUninitialized;
+  using TreeHandle::numberOfChildren;
+  using TreeHandle::numberOfDescendants;
+#if POINCARE_TREE_LOG
+  using TreeHandle::log;
+#endif
+  bool operator==(const Layout & l) const { return TreeHandle::operator==(l); }
+  bool operator!=(const Layout & l) const { return TreeHandle::operator!=(l); }
+  bool hasChild(Layout l) const { return TreeHandle::hasChild(l); }
+  bool hasSibling(Layout l) const { return TreeHandle::hasSibling(l); }
+  bool hasAncestor(Layout l, bool includeSelf) const { return TreeHandle::hasAncestor(l, includeSelf); }
+  int indexOfChild(Layout l) const { return TreeHandle::indexOfChild(l); }
+
   LayoutNode * node() const {
     assert(isUninitialized() || !TreeHandle::node()->isGhost());
     return static_cast<LayoutNode *>(TreeHandle::node());
@@ -94,7 +123,21 @@ public:
   void replaceWithJuxtapositionOf(Layout leftChild, Layout rightChild, LayoutCursor * cursor, bool putCursorInTheMiddle = false);
   // Collapse
   void collapseSiblings(LayoutCursor * cursor);
+
+  /* In-place hierarchy operations, which discard the metrics of the edited
+   * layouts and of their ancestors. */
+  void replaceWithInPlace(Layout l);
+  void replaceChildInPlace(Layout oldChild, Layout newChild);
+  void replaceChildAtIndexInPlace(int oldChildIndex, Layout newChild);
+  void replaceChildAtIndexWithGhostInPlace(int index);
+  void replaceChildWithGhostInPlace(Layout l);
+  void mergeChildrenAtIndexInPlace(Layout l, int i);
+  void swapChildrenInPlace(int i, int j);
 protected:
+  void addChildAtIndexInPlace(Layout l, int index, int currentNumberOfChildren);
+  void removeChildAtIndexInPlace(int i);
+  void removeChildInPlace(Layout l, int childNumberOfChildren);
+  void removeChildrenInPlace(int currentNumberOfChildren);
   // Add
   void addChildAtIndex(Layout l, int index, int currentNumberOfChildren, LayoutCursor * cursor);
   // Remove
@@ -107,6 +150,9 @@ private:
     Right
   };
   void collapseOnDirection(HorizontalDirection direction, int absorbingChildIndex);
+  void invalidMetricsAfterEdit() { node()->invalidSizesPositionsAndBaselinesAfterEdit(); }
+  // Moving t into this layout first detaches it from its current parent
+  static void InvalidParentMetricsBeforeDetaching(Layout l);
 };
 
 }
@@ -50,9 +50,12 @@ public:
     TreeNode(),
     m_baseline(0),
     m_frame(KDRectZero),
+    m_absoluteOrigin(KDPointZero),
     m_baselined(false),
     m_positioned(false),
-    m_sized(false)
+    m_sized(false),
+    m_childrenMetricsInvalid(false),
+    m_absoluteOriginCached(false)
   {
   }
 
@@ -67,8 +70,13 @@ public:
   KDPoint absoluteOrigin();
   KDSize layoutSize();
   KDCoordinate baseline();
-  //TODO: invalid cache when tempering with hierarchy
-  virtual void invalidAllSizesPositionsAndBaselines();
+  void invalidAllSizesPositionsAndBaselines();
+  /* Only discard the metrics an edit of this layout may have changed: the size
+   * and baseline of the layout and of its ancestors. The positions of their
+   * children and the metrics of the children that depend on their siblings are
+   * discarded lazily, when these layouts are measured again. The other layouts
+   * keep their cached metrics. */
+  void invalidSizesPositionsAndBaselinesAfterEdit();
   int serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode = Preferences::PrintFloatMode::Decimal, int numberOfSignificantDigits = 0) const override { assert(false); return 0; }
 
   // Tree
@@ -156,16 +164,26 @@ protected:
   virtual KDSize computeSize() = 0;
   virtual KDCoordinate computeBaseline() = 0;
   virtual KDPoint positionOfChild(LayoutNode * child) = 0;
+  virtual void invalidSizeAndBaseline();
+  virtual bool sizeDependsOnSiblings() const { return false; }
 
   /* m_baseline is the signed vertical distance from the top of the layout to
    * the fraction bar of an hypothetical fraction sibling layout. If the top of
    * the layout is under that bar, the baseline is negative. */
   KDCoordinate m_baseline;
+  // The origin of m_frame is relative to the parent layout
   KDRect m_frame;
-  bool m_baselined; // TODO Do not use so much space for 3 bools
-  bool m_positioned;
-  bool m_sized;
+  /* The absolute origin is cached until an edit discards the metrics of any
+   * layout of the same tree. */
+  KDPoint m_absoluteOrigin;
+  bool m_baselined : 1;
+  bool m_positioned : 1;
+  bool m_sized : 1;
+  bool m_childrenMetricsInvalid : 1;
+  bool m_absoluteOriginCached : 1;
 private:
+  void invalidAbsoluteOrigins();
+  void invalidChildrenMetricsIfNeeded();
   void moveCursorInDescendantsVertically(VerticalDirection direction, LayoutCursor * cursor, bool * shouldRecomputeLayout, bool forSelection);
   void scoreCursorInDescendantsVertically (
     VerticalDirection direction,
@@ -36,15 +36,20 @@ public:
   bool derivate(ReductionContext reductionContext, Expression symbol, Expression symbolValue) override;
   Expression unaryFunctionDifferential(ReductionContext reductionContext) override;
   // Evaluation
-  template<typename U> static Complex<U> computeOnComplex(const std::complex<U> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+  template<typename U> static std::complex<U> computeOnComplex(const std::complex<U> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
     /* log has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
      * followed the convention chosen by the lib c++ of llvm on ]-inf+0i, 0+0i]
      * (warning: log takes the other side of the cut values on ]-inf-0i, 0-0i]). */
-    return Complex<U>::Builder(std::log10(c));
+    return std::log10(c);
   }
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { return templatedApproximateScalar<float>(approximationContext, result); }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { return templatedApproximateScalar<double>(approximationContext, result); }
   template<typename U> Evaluation<U> templatedApproximate(ApproximationContext approximationContext) const;
+  template<typename U> bool templatedApproximateScalar(ApproximationContext approximationContext, std::complex<U> * result) const;
+private:
+  template<typename U> static std::complex<U> computeOnComplexWithBase(const std::complex<U> x, const std::complex<U> n, ApproximationContext approximationContext);
 };
 
 class Logarithm final : public Expression {
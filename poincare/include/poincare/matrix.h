@@ -69,6 +69,8 @@ public:
   Expression createTrace();
   // Inverse the array in-place. Array has to be given in the form array[row_index][column_index]
   template<typename T> static int ArrayInverse(T * array, int numberOfRows, int numberOfColumns);
+  // Determinant of the square array, which is overwritten by its LU factorization
+  template<typename T> static T ArrayDeterminant(T * array, int dim);
   static Matrix CreateIdentity(int dim);
   Matrix createTranspose() const;
   Expression createRef(ExpressionNode::ReductionContext reductionContext, bool * couldComputeRef, bool reduced) const;
@@ -81,6 +83,8 @@ public:
   Matrix cross(Matrix * b, ExpressionNode::ReductionContext reductionContext) const;
   // TODO: find another solution for inverse and determinant (avoid capping the matrix)
   static constexpr int k_maxNumberOfCoefficients = 100;
+  // The inverse is computed on the matrix (A|I)
+  static constexpr int k_maxNumberOfRationalCoefficients = 2*k_maxNumberOfCoefficients;
 
   // Expression
   Expression shallowReduce(Context * context);
@@ -92,6 +96,17 @@ private:
   Expression computeInverseOrDeterminant(bool computeDeterminant, ExpressionNode::ReductionContext reductionContext, bool * couldCompute) const;
   // rowCanonize turns a matrix in its row echelon form, reduced or not.
   Matrix rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant, bool reduced = true);
+  /* rationalRowCanonize is the fraction-free (Bareiss) counterpart of
+   * rowCanonize for matrices of rationals: the elimination is carried out on
+   * integers, without building any intermediate expression. It returns false,
+   * leaving the matrix untouched, if a coefficient is not a rational or if an
+   * integer overflows. */
+  bool rationalRowCanonize(Expression * determinant, bool reduced);
+  /* ArrayLUDecompose factorizes the square array in-place with threshold
+   * partial pivoting, storing L (with an implicit unit diagonal) below the
+   * diagonal and U on and above it. It returns false if the array is
+   * singular. */
+  template<typename T> static bool ArrayLUDecompose(T * array, int dim, int * permutation, bool * permutationIsOdd);
   // Row canonize the array in place
   template<typename T> static void ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * c = nullptr, bool reduced = true);
 
@@ -32,6 +32,12 @@ protected:
   /* With a pool of size < 120k and TreeNode of size 20, a node can't have more
    * than 6144 children which fit in uint16_t. */
   uint16_t m_numberOfChildren;
+private:
+  /* Children are sorted on an array of indexes, which lives on the stack.
+   * Expressions with more children are sorted in the pool. */
+  constexpr static int k_maxNumberOfChildrenSortedByIndex = 128;
+  static bool ChildMustComeAfter(const ExpressionNode * c1, bool c1IsMatrix, const ExpressionNode * c2, bool c2IsMatrix, ExpressionOrder order, bool canSwapMatrices, bool canBeInterrupted);
+  void sortChildrenInPoolInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices, bool canBeInterrupted);
 };
 
 class NAryExpression : public Expression {
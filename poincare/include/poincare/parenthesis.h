@@ -35,6 +35,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { return childAtIndex(0)->approximateScalar(p, approximationContext, result); }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { return childAtIndex(0)->approximateScalar(p, approximationContext, result); }
 private:
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
 };
@@ -38,8 +38,8 @@ public:
   int polynomialDegree(Context * context, const char * symbolName) const override;
   int getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[], ExpressionNode::SymbolicComputation symbolicComputation) const override;
 
-  template<typename T> static Complex<T> computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
-  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
+  template<typename T> static std::complex<T> computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
+  template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
 
 private:
   constexpr static int k_maxApproximatePowerMatrix = 1000;
@@ -70,7 +70,15 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return templatedApproximateScalar<float>(approximationContext, result);
+  }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return templatedApproximateScalar<double>(approximationContext, result);
+  }
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
+ template<typename T> bool templatedApproximateScalar(ApproximationContext approximationContext, std::complex<T> * result) const;
+ template<typename T> bool approximateRationalIndex(T * p, T * q) const;
 };
 
 class Power final : public Expression {
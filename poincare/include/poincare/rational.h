@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class RationalNode final : public NumberNode {
+  friend class Rational;
 public:
   RationalNode(const native_uint_t * i, uint8_t numeratorSize, const native_uint_t * j, uint8_t denominatorSize, bool negative);
 
@@ -42,6 +43,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { *result = ComplexNode<float>::Record(templatedApproximate<float>()); return true; }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { *result = ComplexNode<double>::Record(templatedApproximate<double>()); return true; }
   template<typename T> T templatedApproximate() const;
 
   // Basic test
@@ -57,6 +60,11 @@ public:
 
   static int NaturalOrder(const RationalNode * i, const RationalNode * j);
 private:
+  /* Rationals whose numerator and denominator fit in one digit are combined
+   * on native integers, without building any Integer. */
+  bool hasNativeNumeratorAndDenominator() const { return m_numberOfDigitsNumerator <= 1 && m_numberOfDigitsDenominator <= 1; }
+  native_uint_t nativeUnsignedNumerator() const { assert(hasNativeNumeratorAndDenominator()); return m_numberOfDigitsNumerator == 0 ? 0 : m_digits[0]; }
+  native_uint_t nativeDenominator() const { assert(hasNativeNumeratorAndDenominator()); return m_digits[m_numberOfDigitsNumerator]; }
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const override;
   Expression shallowReduce(ReductionContext reductionContext) override;
   Expression shallowBeautify(ReductionContext * reductionContext) override;
@@ -118,6 +126,8 @@ public:
 
 private:
   static Rational Builder(const native_uint_t * i, uint8_t numeratorSize, const native_uint_t * j, uint8_t denominatorSize, bool negative);
+  // numerator/denominator has to be irreducible
+  static Rational Builder(double_native_uint_t numerator, double_native_uint_t denominator, bool negative);
 
   RationalNode * node() { return static_cast<RationalNode *>(Number::node()); }
 
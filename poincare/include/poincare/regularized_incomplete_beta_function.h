@@ -31,6 +31,9 @@
 namespace Poincare {
 
 double RegularizedIncompleteBetaFunction(double a, double b, double x);
+/* Same function, with lnBeta = ln(B(a,b)) given by the caller, which saves
+ * three lgamma when the parameters do not change between calls. */
+double RegularizedIncompleteBetaFunction(double a, double b, double x, double lnBeta);
 
 }
 
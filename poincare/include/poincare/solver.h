@@ -15,6 +15,14 @@ public:
 
   // Root
   static double BrentRoot(double ax, double bx, double precision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
+  /* Roots looks for all the roots of the function on [start, end] in a
+   * single sweep. The interval is sampled once with the given step: sign
+   * changes are refined with BrentRoot, extrema that could reach 0 are refined
+   * with BrentMinimum and intervals on which the function varies quickly
+   * compared to its distance to 0 are adaptively subdivided. At most
+   * maxNumberOfRoots roots are written in increasing order into roots, and
+   * their number is returned. */
+  static int Roots(double start, double end, double step, double * roots, int maxNumberOfRoots, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
   static Coordinate2D<double> IncreasingFunctionRoot(double ax, double bx, double resultPrecision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr, double * resultEvaluation = nullptr);
 
   // Proba
@@ -26,9 +34,13 @@ public:
   template<typename T> static T CumulativeDistributiveFunctionForNDefinedFunction(T x, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
 
 private:
+  class RootsSearch;
   constexpr static int k_maxNumberOfOperations = 1000000;
   constexpr static double k_maxProbability = 0.9999995;
   constexpr static double k_sqrtEps = 1.4901161193847656E-8; // sqrt(DBL_EPSILON)
+  constexpr static double k_relativeZeroPrecision = 1.0E-5; // Relative to the sampling step
+  constexpr static double k_relativeRootPrecision = 1.0E-6; // Relative to the sampling step
+  constexpr static int k_maxNumberOfSubdivisions = 4;
   constexpr static double k_goldenRatio = 0.381966011250105151795413165634361882279690820194237137864; // (3-sqrt(5))/2
 };
 
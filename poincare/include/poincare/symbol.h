@@ -43,6 +43,8 @@ public:
   /* Approximation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateScalar(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { return templatedApproximateScalar<float>(approximationContext, result); }
+  bool approximateScalar(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { return templatedApproximateScalar<double>(approximationContext, result); }
 
   bool isUnknown() const;
 private:
@@ -50,6 +52,7 @@ private:
 
   size_t nodeSize() const override { return sizeof(SymbolNode); }
   template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
+  template<typename T> bool templatedApproximateScalar(ApproximationContext approximationContext, std::complex<T> * result) const;
 };
 
 class Symbol final : public SymbolAbstract {
@@ -41,7 +41,7 @@ public:
     static constexpr int k_numberOfPrefixes = 13;
     static const Prefix * Prefixes();
     static const Prefix * EmptyPrefix();
-    const char * symbol() const { return m_symbol; }
+    constexpr const char * symbol() const { return m_symbol; }
     int8_t exponent() const { return m_exponent; }
     int serialize(char * buffer, int bufferSize) const;
   private:
@@ -120,13 +120,11 @@ public:
     virtual bool hasSpecialAdditionalExpressions(double value, Preferences::UnitFormat unitFormat) const { return false; }
     virtual int setAdditionalExpressions(double value, Expression * dest, int availableLength, ExpressionNode::ReductionContext reductionContext) const { return 0; }
 
-    const char * rootSymbol() const { return m_rootSymbol; }
+    constexpr const char * rootSymbol() const { return m_rootSymbol; }
     double ratio() const { return m_ratio; }
     bool isInputPrefixable() const { return m_inputPrefixable != Prefixable::None; }
     bool isOutputPrefixable() const { return m_outputPrefixable != Prefixable::None; }
     int serialize(char * buffer, int bufferSize, const Prefix * prefix) const;
-    bool canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const;
-    bool canParse(const char * symbol, size_t length, const Prefix * * prefix) const;
     Expression toBaseUnits() const;
     bool canPrefix(const Prefix * prefix, bool input) const;
     const Prefix * findBestPrefix(double value, double exponent) const;
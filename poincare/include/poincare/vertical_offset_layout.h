@@ -48,6 +48,8 @@ protected:
   KDSize computeSize() override;
   KDCoordinate computeBaseline() override;
   KDPoint positionOfChild(LayoutNode * child) override;
+  // The indice is placed relatively to the base layout, its left sibling
+  bool sizeDependsOnSiblings() const override { return true; }
 private:
   constexpr static KDCoordinate k_indiceHeight = 5;
   constexpr static KDCoordinate k_separationMargin = 5;
@@ -22,16 +22,43 @@ public:
 
   typedef float (*ValueAtAbscissa)(float abscissa, Context * context, const void * auxiliary);
 
+  /* Samples of a function on the log-scale grid explored when looking for its
+   * points of interest, on both sides of the grid's center. Where the grid is
+   * dense enough, the Y range and the range with a ratio are computed from
+   * them instead of sampling the function again. */
+  class Samples {
+  public:
+    Samples() : m_center(NAN), m_numberOfSamples(0) {}
+    /* Return whether the grid covers [xMin, xMax] with at least
+     * numberOfSamples samples. */
+    bool areDenseOn(float xMin, float xMax, int numberOfSamples) const;
+    /* Interpolation of the samples around x, which is linear unless the
+     * function explodes or jumps between them. */
+    float valueAt(float x) const;
+  private:
+    friend class Zoom;
+    // The grid extends on each side up to k_maximalDistance
+    static constexpr int k_maxNumberOfSamplesPerSide = 190;
+    void addSample(int side, float distance, float value);
+    int indexBefore(float distance) const;
+    float m_center;
+    int m_numberOfSamples;
+    float m_distances[k_maxNumberOfSamplesPerSide];
+    float m_values[2][k_maxNumberOfSamplesPerSide];
+  };
+
   /* Find the most suitable window to display the function's points of
    * interest. Return false if the X range was given a default value because
-   * there were no points of interest. */
-  static bool InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, float tMin, float tMax, Context * context, const void * auxiliary);
+   * there were no points of interest. If precision is not zero, the values
+   * are rounded to it to look for the points of interest. The function's exact
+   * values on the grid are kept in samples if provided. */
+  static bool InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, float tMin, float tMax, Context * context, const void * auxiliary, float precision = 0.f, Samples * samples = nullptr);
   /* Find the best Y range to display the function on [xMin, xMax], but crop
    * the values that are outside of the function's order of magnitude. */
-  static void RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary);
+  static void RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, const Samples * samples = nullptr);
   /* Find the best window to display functions, with a specified ratio
    * between X and Y. Usually used to find the most fitting orthonormal range. */
-  static void RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary);
+  static void RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, const Samples * samples = nullptr);
   static void FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary);
 
   /* Find the bounding box of the given ranges. */
@@ -73,11 +100,15 @@ private:
   /* IsConvexAroundExtremum checks whether an interval contains an extremum or
    * an asymptote, by recursively computing the slopes. In case of an extremum,
    * the slope should taper off toward the center. */
-  static bool IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2, float x3, float y1, float y2, float y3, Context * context, const void * auxiliary, int iterations = 3);
+  static bool IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2, float x3, float y1, float y2, float y3, Context * context, const void * auxiliary, float precision, int iterations = 3);
+  static float Round(float y, float precision) { return precision > 0.f ? precision * std::round(y / precision) : y; }
   /* If the function is discontinuous between its points of interest, there
    * might be a lot of empty space in the middle of the screen. In that case,
    * we want to zoom out to see more of the graph. */
   static void ExpandSparseWindow(float * sample, int length, float * xMin, float * xMax, float * yMin, float * yMax);
+  /* Replace the evaluation with the interpolation of the samples when they
+   * are dense enough on [xMin, xMax]. */
+  static void UseSamplesIfDenseOn(const Samples * samples, float xMin, float xMax, int numberOfSamples, ValueAtAbscissa * evaluation, const void ** auxiliary);
 };
 
 }
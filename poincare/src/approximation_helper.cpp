@@ -83,19 +83,29 @@ template<typename T> Evaluation<T> ApproximationHelper::Map(const ExpressionNode
   assert(expression->numberOfChildren() == 1);
   Evaluation<T> input = expression->childAtIndex(0)->approximate(T(), approximationContext);
   if (input.type() == EvaluationNode<T>::Type::Complex) {
-    return compute(static_cast<Complex<T> &>(input).stdComplex(), approximationContext.complexFormat(), approximationContext.angleUnit());
+    return Complex<T>::Builder(compute(static_cast<Complex<T> &>(input).stdComplex(), approximationContext.complexFormat(), approximationContext.angleUnit()));
   } else {
     assert(input.type() == EvaluationNode<T>::Type::MatrixComplex);
     MatrixComplex<T> m = static_cast<MatrixComplex<T> &>(input);
     MatrixComplex<T> result = MatrixComplex<T>::Builder();
     for (int i = 0; i < m.numberOfChildren(); i++) {
-      result.addChildAtIndexInPlace(compute(m.complexAtIndex(i), approximationContext.complexFormat(), approximationContext.angleUnit()), i, i);
+      result.addChildAtIndexInPlace(Complex<T>::Builder(compute(m.complexAtIndex(i), approximationContext.complexFormat(), approximationContext.angleUnit())), i, i);
     }
     result.setDimensions(m.numberOfRows(), m.numberOfColumns());
     return std::move(result);
   }
 }
 
+template<typename T> bool ApproximationHelper::MapScalar(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ComplexCompute<T> compute, std::complex<T> * result) {
+  assert(expression->numberOfChildren() == 1);
+  std::complex<T> input;
+  if (!expression->childAtIndex(0)->approximateScalar(T(), approximationContext, &input)) {
+    return false;
+  }
+  *result = ComplexNode<T>::Record(compute(input, approximationContext.complexFormat(), approximationContext.angleUnit()));
+  return true;
+}
+
 template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ComplexAndComplexReduction<T> computeOnComplexes, ComplexAndMatrixReduction<T> computeOnComplexAndMatrix, MatrixAndComplexReduction<T> computeOnMatrixAndComplex, MatrixAndMatrixReduction<T> computeOnMatrices) {
   assert(expression->numberOfChildren() > 0);
   Evaluation<T> result = expression->childAtIndex(0)->approximate(T(), approximationContext);
@@ -103,7 +113,7 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
     Evaluation<T> intermediateResult;
     Evaluation<T> nextOperandEvaluation = expression->childAtIndex(i)->approximate(T(), approximationContext);
     if (result.type() == EvaluationNode<T>::Type::Complex && nextOperandEvaluation.type() == EvaluationNode<T>::Type::Complex) {
-      intermediateResult = computeOnComplexes(static_cast<Complex<T> &>(result).stdComplex(), static_cast<Complex<T> &>(nextOperandEvaluation).stdComplex(), approximationContext.complexFormat());
+      intermediateResult = Complex<T>::Builder(computeOnComplexes(static_cast<Complex<T> &>(result).stdComplex(), static_cast<Complex<T> &>(nextOperandEvaluation).stdComplex(), approximationContext.complexFormat()));
     } else if (result.type() == EvaluationNode<T>::Type::Complex) {
       assert(nextOperandEvaluation.type() == EvaluationNode<T>::Type::MatrixComplex);
       intermediateResult = computeOnComplexAndMatrix(static_cast<Complex<T> &>(result).stdComplex(), static_cast<MatrixComplex<T> &>(nextOperandEvaluation), approximationContext.complexFormat());
@@ -123,10 +133,28 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
   return result;
 }
 
+template<typename T> bool ApproximationHelper::MapReduceScalar(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ComplexAndComplexReduction<T> computeOnComplexes, std::complex<T> * result) {
+  assert(expression->numberOfChildren() > 0);
+  if (!expression->childAtIndex(0)->approximateScalar(T(), approximationContext, result)) {
+    return false;
+  }
+  for (int i = 1; i < expression->numberOfChildren(); i++) {
+    std::complex<T> nextOperand;
+    if (!expression->childAtIndex(i)->approximateScalar(T(), approximationContext, &nextOperand)) {
+      return false;
+    }
+    *result = ComplexNode<T>::Record(computeOnComplexes(*result, nextOperand, approximationContext.complexFormat()));
+    if (std::isnan(result->real()) && std::isnan(result->imag())) {
+      return true;
+    }
+  }
+  return true;
+}
+
 template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Poincare::Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes) {
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), c, complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), c, complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -138,7 +166,7 @@ template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnComplexM
   }
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -151,12 +179,16 @@ template std::complex<float> Poincare::ApproximationHelper::NeglectRealOrImagina
 template std::complex<double> Poincare::ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable<double>(std::complex<double>,std::complex<double>,std::complex<double>,bool);
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::Map(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexCompute<float> compute);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::Map(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexCompute<double> compute);
+template bool Poincare::ApproximationHelper::MapScalar(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexCompute<float> compute, std::complex<float> * result);
+template bool Poincare::ApproximationHelper::MapScalar(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexCompute<double> compute, std::complex<double> * result);
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<float> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<float> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<float> computeOnMatrices);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<double> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<double> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<double> computeOnMatrices);
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template bool Poincare::ApproximationHelper::MapReduceScalar(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes, std::complex<float> * result);
+template bool Poincare::ApproximationHelper::MapReduceScalar(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes, std::complex<double> * result);
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
 
 
 }
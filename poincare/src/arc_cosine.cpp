@@ -24,7 +24,7 @@ Expression ArcCosineNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
   if (c.imag() == 0 && std::fabs(c.real()) <= (T)1.0) {
     /* acos: [-1;1] -> R
@@ -45,7 +45,7 @@ Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences:
     }
   }
   result = ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c);
-  return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
+  return Trigonometry::ConvertRadianToAngleUnit(result, angleUnit);
 }
 
 
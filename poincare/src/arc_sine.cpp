@@ -24,7 +24,7 @@ Expression ArcSineNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
   if (c.imag() == 0 && std::fabs(c.real()) <= (T)1.0) {
     /* asin: [-1;1] -> R
@@ -45,7 +45,7 @@ Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::C
     }
   }
   result = ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c);
-  return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
+  return Trigonometry::ConvertRadianToAngleUnit(result, angleUnit);
 }
 
 
@@ -20,7 +20,7 @@ int ArcTangentNode::serialize(char * buffer, int bufferSize, Preferences::PrintF
 }
 
 template<typename T>
-Complex<T> ArcTangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcTangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
   if (c.imag() == 0 && std::fabs(c.real()) <= (T)1.0) {
     /* atan: R -> R
@@ -41,7 +41,7 @@ Complex<T> ArcTangentNode::computeOnComplex(const std::complex<T> c, Preferences
     }
   }
   result = ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c);
-  return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
+  return Trigonometry::ConvertRadianToAngleUnit(result, angleUnit);
 }
 
 Expression ArcTangentNode::shallowReduce(ReductionContext reductionContext) {
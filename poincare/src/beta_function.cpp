@@ -11,4 +11,8 @@ double BetaFunction(double a, double b) {
   return std::exp(std::lgamma(a) + std::lgamma(b) - std::lgamma(a+b));
 }
 
+double LnBetaFunction(double a, double b) {
+  return std::lgamma(a) + std::lgamma(b) - std::lgamma(a+b);
+}
+
 }
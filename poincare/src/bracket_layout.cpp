@@ -36,9 +36,9 @@ void BracketLayoutNode::moveCursorRight(LayoutCursor * cursor, bool * shouldReco
   }
 }
 
-void BracketLayoutNode::invalidAllSizesPositionsAndBaselines() {
+void BracketLayoutNode::invalidSizeAndBaseline() {
   m_childHeightComputed = false;
-  LayoutNode::invalidAllSizesPositionsAndBaselines();
+  LayoutNode::invalidSizeAndBaseline();
 }
 
 KDCoordinate BracketLayoutNode::computeBaseline() {
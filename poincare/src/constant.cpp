@@ -63,15 +63,15 @@ Layout ConstantNode::createLayout(Preferences::PrintFloatMode floatDisplayMode,
 }
 
 template<typename T>
-Evaluation<T> ConstantNode::templatedApproximate() const {
+std::complex<T> ConstantNode::templatedApproximate() const {
   if (isIComplex()) {
-    return Complex<T>::Builder(0.0, 1.0);
+    return std::complex<T>(0.0, 1.0);
   }
   if (isPi()) {
-    return Complex<T>::Builder(M_PI);
+    return std::complex<T>(M_PI);
   }
   assert(isExponential());
-  return Complex<T>::Builder(M_E);
+  return std::complex<T>(M_E);
 }
 
 Expression ConstantNode::shallowReduce(ReductionContext reductionContext) {
@@ -16,10 +16,10 @@ constexpr Expression::FunctionHelper Cosine::s_functionHelper;
 int CosineNode::numberOfChildren() const { return Cosine::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> CosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> CosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
   std::complex<T> res = std::cos(angleInput);
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
+  return ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput);
 }
 
 Layout CosineNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
@@ -0,0 +1,369 @@
+#include <poincare/enclosure.h>
+#include <poincare/approximation_helper.h>
+#include <poincare/constant.h>
+#include <poincare/number.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <algorithm>
+#include <assert.h>
+#include <string.h>
+
+namespace Poincare {
+
+/* Beyond these values, the cosine and the sine are enclosed by [-1,1] and the
+ * exponents are not integer powers, to keep the rounding errors small. */
+static constexpr double k_maxTrigonometricArgument = 1e6;
+static constexpr double k_maxIntegerExponent = 1e3;
+static constexpr double k_maxExactInteger = 9007199254740992.0;
+
+/* Round outwards the results of the operations. Exact zeros are kept, so that
+ * the sign of a bound is never lost. */
+static double RoundDown(double x) { return x == 0.0 ? x : std::nextafter(x, -INFINITY); }
+static double RoundUp(double x) { return x == 0.0 ? x : std::nextafter(x, INFINITY); }
+
+// Whether [a, b] contains point + k*period for some integer k
+static bool ContainsPeriodicPoint(double a, double b, double point, double period) {
+  return point + std::ceil((a - point) / period) * period <= b;
+}
+
+/* The approximations of the trigonometric functions neglect the results close
+ * to zero (see ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable):
+ * the enclosures of these functions include zero in that case. */
+static void IncludeNeglectedZero(double * min, double * max) {
+  const double neglectedValue = 10.0 * ApproximationHelper::Epsilon<double>();
+  if (0.0 < *min && *min <= neglectedValue) {
+    *min = 0.0;
+  }
+  if (-neglectedValue <= *max && *max < 0.0) {
+    *max = 0.0;
+  }
+}
+
+// 0*inf is 0 when the zero is exact, as in the intervals
+static double Product(double x, double y) {
+  return (x == 0.0 || y == 0.0) ? 0.0 : x * y;
+}
+
+Enclosure::Enclosure(double min, double max, Status status) :
+  m_min(std::isnan(min) ? -INFINITY : min),
+  m_max(std::isnan(max) ? INFINITY : max),
+  m_status(status)
+{
+}
+
+Enclosure Enclosure::ForExpression(const Expression e, const char * symbol, double xMin, double xMax, Preferences::AngleUnit angleUnit) {
+  assert(xMin <= xMax);
+  double angleFactor = 1.0;
+  if (angleUnit == Preferences::AngleUnit::Degree) {
+    angleFactor = M_PI / 180.0;
+  } else if (angleUnit == Preferences::AngleUnit::Gradian) {
+    angleFactor = M_PI / 200.0;
+  }
+  return Enclose(e, symbol, xMin, xMax, angleFactor);
+}
+
+Enclosure Enclosure::Enclose(const Expression e, const char * symbol, double xMin, double xMax, double angleFactor) {
+  switch (e.type()) {
+    case ExpressionNode::Type::Undefined:
+    case ExpressionNode::Type::Unreal:
+      return Undefined();
+    case ExpressionNode::Type::BasedInteger:
+    case ExpressionNode::Type::Rational:
+    case ExpressionNode::Type::Float:
+    case ExpressionNode::Type::Double:
+    case ExpressionNode::Type::Infinity:
+    {
+      double value = static_cast<NumberNode *>(e.node())->doubleApproximation();
+      // Only the integers below 2^53 are exact doubles
+      if ((e.type() == ExpressionNode::Type::Rational && !static_cast<const Rational &>(e).isInteger()) || (std::isfinite(value) && std::fabs(value) > k_maxExactInteger)) {
+        return Enclosure(RoundDown(value), RoundUp(value));
+      }
+      return Enclosure(value, value);
+    }
+    case ExpressionNode::Type::Constant:
+    {
+      const Constant & c = static_cast<const Constant &>(e);
+      if (c.isPi()) {
+        return Enclosure(RoundDown(M_PI), RoundUp(M_PI));
+      }
+      if (c.isExponential()) {
+        return Enclosure(RoundDown(M_E), RoundUp(M_E));
+      }
+      return Unknown();
+    }
+    case ExpressionNode::Type::Symbol:
+      if (strcmp(static_cast<const Symbol &>(e).name(), symbol) == 0) {
+        return Enclosure(xMin, xMax);
+      }
+      return Unknown();
+    case ExpressionNode::Type::Parenthesis:
+      return Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor);
+    case ExpressionNode::Type::Opposite:
+      return Opposite(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor));
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Multiplication:
+    {
+      bool isAddition = e.type() == ExpressionNode::Type::Addition;
+      Enclosure result = Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor);
+      const int childrenCount = e.numberOfChildren();
+      for (int i = 1; i < childrenCount; i++) {
+        Enclosure child = Enclose(e.childAtIndex(i), symbol, xMin, xMax, angleFactor);
+        result = isAddition ? Add(result, child) : Multiply(result, child);
+      }
+      return result;
+    }
+    case ExpressionNode::Type::Subtraction:
+      return Add(
+          Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor),
+          Opposite(Enclose(e.childAtIndex(1), symbol, xMin, xMax, angleFactor)));
+    case ExpressionNode::Type::Division:
+      return Multiply(
+          Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor),
+          Inverse(Enclose(e.childAtIndex(1), symbol, xMin, xMax, angleFactor)));
+    case ExpressionNode::Type::Power:
+    {
+      Expression base = e.childAtIndex(0);
+      Expression exponent = e.childAtIndex(1);
+      Enclosure exponentEnclosure = Enclose(exponent, symbol, xMin, xMax, angleFactor);
+      double n = exponentEnclosure.m_min;
+      if (exponentEnclosure.isDefined() && n == exponentEnclosure.m_max && n == std::round(n) && std::fabs(n) <= k_maxIntegerExponent) {
+        return IntegerPower(Enclose(base, symbol, xMin, xMax, angleFactor), static_cast<int>(n));
+      }
+      if (base.type() == ExpressionNode::Type::Constant && static_cast<const Constant &>(base).isExponential()) {
+        return Exponential(exponentEnclosure);
+      }
+      bool evenRootExponent = exponent.type() == ExpressionNode::Type::Rational && static_cast<const Rational &>(exponent).integerDenominator().isEven();
+      return Power(Enclose(base, symbol, xMin, xMax, angleFactor), exponentEnclosure, evenRootExponent);
+    }
+    case ExpressionNode::Type::SquareRoot:
+      return SquareRoot(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor));
+    case ExpressionNode::Type::NaperianLogarithm:
+      return Logarithm(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor), std::log);
+    case ExpressionNode::Type::Logarithm:
+      if (e.numberOfChildren() == 1) {
+        return Logarithm(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor), std::log10);
+      }
+      return Multiply(
+          Logarithm(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor), std::log),
+          Inverse(Logarithm(Enclose(e.childAtIndex(1), symbol, xMin, xMax, angleFactor), std::log)));
+    case ExpressionNode::Type::AbsoluteValue:
+      return AbsoluteValue(Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor));
+    case ExpressionNode::Type::Sine:
+    case ExpressionNode::Type::Cosine:
+    case ExpressionNode::Type::Tangent:
+    {
+      Enclosure angle = Enclose(e.childAtIndex(0), symbol, xMin, xMax, angleFactor);
+      if (angleFactor != 1.0) {
+        angle = Multiply(angle, Enclosure(RoundDown(angleFactor), RoundUp(angleFactor)));
+      }
+      if (e.type() == ExpressionNode::Type::Tangent) {
+        return Tangent(angle);
+      }
+      return SineOrCosine(angle, e.type() == ExpressionNode::Type::Cosine);
+    }
+    default:
+      return Unknown();
+  }
+}
+
+Enclosure::Status Enclosure::CombinedStatus(Status s1, Status s2) {
+  if (s1 == Status::Undefined || s2 == Status::Undefined) {
+    return Status::Undefined;
+  }
+  if (s1 == Status::Unknown || s2 == Status::Unknown) {
+    return Status::Unknown;
+  }
+  if (s1 == Status::PartlyDefined || s2 == Status::PartlyDefined) {
+    return Status::PartlyDefined;
+  }
+  return Status::Defined;
+}
+
+Enclosure Enclosure::Add(Enclosure a, Enclosure b) {
+  Status status = CombinedStatus(a.m_status, b.m_status);
+  if (status == Status::Undefined || status == Status::Unknown) {
+    return Enclosure(NAN, NAN, status);
+  }
+  return Enclosure(RoundDown(a.m_min + b.m_min), RoundUp(a.m_max + b.m_max), status);
+}
+
+Enclosure Enclosure::Multiply(Enclosure a, Enclosure b) {
+  Status status = CombinedStatus(a.m_status, b.m_status);
+  if (status == Status::Undefined || status == Status::Unknown) {
+    return Enclosure(NAN, NAN, status);
+  }
+  double p1 = Product(a.m_min, b.m_min);
+  double p2 = Product(a.m_min, b.m_max);
+  double p3 = Product(a.m_max, b.m_min);
+  double p4 = Product(a.m_max, b.m_max);
+  return Enclosure(
+      RoundDown(std::min(std::min(p1, p2), std::min(p3, p4))),
+      RoundUp(std::max(std::max(p1, p2), std::max(p3, p4))),
+      status);
+}
+
+Enclosure Enclosure::Opposite(Enclosure a) {
+  return Enclosure(-a.m_max, -a.m_min, a.m_status);
+}
+
+Enclosure Enclosure::Inverse(Enclosure a) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  if (a.m_min > 0.0 || a.m_max < 0.0) {
+    return Enclosure(RoundDown(1.0 / a.m_max), RoundUp(1.0 / a.m_min), a.m_status);
+  }
+  if (a.m_min == 0.0 && a.m_max == 0.0) {
+    return Undefined();
+  }
+  // The inverse is undefined at 0 and unbounded around it
+  double min = a.m_min == 0.0 ? RoundDown(1.0 / a.m_max) : -INFINITY;
+  double max = a.m_max == 0.0 ? RoundUp(1.0 / a.m_min) : INFINITY;
+  return Enclosure(min, max, Status::PartlyDefined);
+}
+
+Enclosure Enclosure::IntegerPower(Enclosure a, int n) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  if (n == 0) {
+    // 0^0 is undefined
+    return Enclosure(1.0, 1.0, a.contains(0.0) ? Status::PartlyDefined : a.m_status);
+  }
+  if (n < 0) {
+    return Inverse(IntegerPower(a, -n));
+  }
+  double powerOfMin = std::pow(a.m_min, n);
+  double powerOfMax = std::pow(a.m_max, n);
+  if (n % 2 == 1 || a.m_min >= 0.0) {
+    return Enclosure(RoundDown(powerOfMin), RoundUp(powerOfMax), a.m_status);
+  }
+  if (a.m_max <= 0.0) {
+    return Enclosure(RoundDown(powerOfMax), RoundUp(powerOfMin), a.m_status);
+  }
+  return Enclosure(0.0, RoundUp(std::max(powerOfMin, powerOfMax)), a.m_status);
+}
+
+Enclosure Enclosure::Power(Enclosure a, Enclosure b, bool evenRootExponent) {
+  Status status = CombinedStatus(a.m_status, b.m_status);
+  if (status == Status::Undefined || status == Status::Unknown) {
+    return Enclosure(NAN, NAN, status);
+  }
+  if (a.m_min < 0.0) {
+    /* Negative bases only have real powers for rational exponents. Those with
+     * an even denominator are undefined there. */
+    if (!evenRootExponent) {
+      return Unknown();
+    }
+    if (a.m_max < 0.0) {
+      return Undefined();
+    }
+    a = Enclosure(0.0, a.m_max);
+    status = Status::PartlyDefined;
+  }
+  if (a.m_min == 0.0 && b.m_min <= 0.0) {
+    // 0^0 is undefined and 0^-x is not bounded
+    status = Status::PartlyDefined;
+  }
+  /* On positive bases, the power is monotonic with respect to each of its
+   * arguments: its extrema are reached on the corners. */
+  double p1 = std::pow(a.m_min, b.m_min);
+  double p2 = std::pow(a.m_min, b.m_max);
+  double p3 = std::pow(a.m_max, b.m_min);
+  double p4 = std::pow(a.m_max, b.m_max);
+  return Enclosure(
+      RoundDown(std::min(std::min(p1, p2), std::min(p3, p4))),
+      RoundUp(std::max(std::max(p1, p2), std::max(p3, p4))),
+      status);
+}
+
+Enclosure Enclosure::Exponential(Enclosure a) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  return Enclosure(RoundDown(std::exp(a.m_min)), RoundUp(std::exp(a.m_max)), a.m_status);
+}
+
+Enclosure Enclosure::Logarithm(Enclosure a, double (*logarithm)(double)) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  if (a.m_max <= 0.0) {
+    return Undefined();
+  }
+  if (a.m_min <= 0.0) {
+    return Enclosure(-INFINITY, RoundUp(logarithm(a.m_max)), Status::PartlyDefined);
+  }
+  return Enclosure(RoundDown(logarithm(a.m_min)), RoundUp(logarithm(a.m_max)), a.m_status);
+}
+
+Enclosure Enclosure::SquareRoot(Enclosure a) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  if (a.m_max < 0.0) {
+    return Undefined();
+  }
+  if (a.m_min < 0.0) {
+    return Enclosure(0.0, RoundUp(std::sqrt(a.m_max)), Status::PartlyDefined);
+  }
+  return Enclosure(RoundDown(std::sqrt(a.m_min)), RoundUp(std::sqrt(a.m_max)), a.m_status);
+}
+
+Enclosure Enclosure::AbsoluteValue(Enclosure a) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown || a.m_min >= 0.0) {
+    return a;
+  }
+  if (a.m_max <= 0.0) {
+    return Opposite(a);
+  }
+  return Enclosure(0.0, std::max(-a.m_min, a.m_max), a.m_status);
+}
+
+Enclosure Enclosure::SineOrCosine(Enclosure a, bool cosine) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  if (!a.isBounded() || a.m_max - a.m_min >= 2.0 * M_PI || std::fabs(a.m_min) > k_maxTrigonometricArgument) {
+    return Enclosure(-1.0, 1.0, a.m_status);
+  }
+  double valueAtMin = cosine ? std::cos(a.m_min) : std::sin(a.m_min);
+  double valueAtMax = cosine ? std::cos(a.m_max) : std::sin(a.m_max);
+  double min = std::min(valueAtMin, valueAtMax);
+  double max = std::max(valueAtMin, valueAtMax);
+  // The sine peaks at π/2+2kπ and the cosine at 2kπ
+  double peak = cosine ? 0.0 : M_PI_2;
+  if (ContainsPeriodicPoint(a.m_min, a.m_max, peak, 2.0 * M_PI)) {
+    max = 1.0;
+  }
+  if (ContainsPeriodicPoint(a.m_min, a.m_max, peak + M_PI, 2.0 * M_PI)) {
+    min = -1.0;
+  }
+  min = std::max(-1.0, RoundDown(min));
+  max = std::min(1.0, RoundUp(max));
+  IncludeNeglectedZero(&min, &max);
+  return Enclosure(min, max, a.m_status);
+}
+
+Enclosure Enclosure::Tangent(Enclosure a) {
+  if (a.m_status == Status::Undefined || a.m_status == Status::Unknown) {
+    return a;
+  }
+  Enclosure unbounded(-INFINITY, INFINITY, Status::PartlyDefined);
+  if (!a.isBounded() || a.m_max - a.m_min >= M_PI || std::fabs(a.m_min) > k_maxTrigonometricArgument
+   || ContainsPeriodicPoint(a.m_min, a.m_max, M_PI_2, M_PI)) {
+    return unbounded;
+  }
+  double valueAtMin = std::tan(a.m_min);
+  double valueAtMax = std::tan(a.m_max);
+  if (valueAtMin > valueAtMax) {
+    // An asymptote was missed because of rounding errors
+    return unbounded;
+  }
+  double min = RoundDown(valueAtMin);
+  double max = RoundUp(valueAtMax);
+  IncludeNeglectedZero(&min, &max);
+  return Enclosure(min, max, a.m_status);
+}
+
+}
@@ -75,6 +75,13 @@ Expression Expression::Parse(char const * string, Context * context, bool addPar
   }
 #endif
   // Build the Expression in the Tree Pool
+  return ExpressionFromTreeAddress(address, size);
+}
+
+Expression Expression::ExpressionFromTreeAddress(const void * address, size_t size) {
+  if (address == nullptr || size == 0) {
+    return Expression();
+  }
   return Expression(static_cast<ExpressionNode *>(TreePool::sharedPool()->copyTreeFromAddress(address, size)));
 }
 
@@ -902,7 +909,18 @@ Expression Expression::approximate(Context * context, Preferences::ComplexFormat
 
 template<typename U>
 U Expression::approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool withinReduce) const {
-  return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  /* Approximate on the stack first, which spares the pool the intermediate
+   * evaluations. Non scalar approximations go through approximateToEvaluation. */
+  sApproximationEncounteredComplex = false;
+  sSimplificationHasBeenInterrupted = false;
+  std::complex<U> result;
+  if (!node()->approximateScalar(U(), ExpressionNode::ApproximationContext(context, complexFormat, angleUnit, withinReduce), &result)) {
+    return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  }
+  if ((complexFormat == Preferences::ComplexFormat::Real && sApproximationEncounteredComplex) || result.imag() != (U)0.0) {
+    return NAN;
+  }
+  return result.real();
 }
 
 template<typename U>
@@ -1057,6 +1075,29 @@ double Expression::nextRoot(const char * symbol, double start, double step, doub
       }, context, complexFormat, angleUnit, nullptr);
 }
 
+int Expression::roots(const char * symbol, double start, double step, double max, double * roots, int maxNumberOfRoots, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  assert(step > 0.0);
+  if (start >= max) {
+    return 0;
+  }
+  // Same convention as nextRoot for the null function
+  if (nullStatus(context) == ExpressionNode::NullStatus::Null) {
+    int numberOfRoots = 0;
+    double root = start + step;
+    while (numberOfRoots < maxNumberOfRoots && root <= max) {
+      roots[numberOfRoots++] = root;
+      root += step;
+    }
+    return numberOfRoots;
+  }
+  return Solver::Roots(start, max, step, roots, maxNumberOfRoots,
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+        const char * symbol = reinterpret_cast<const char *>(context2);
+        return expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+      }, context, complexFormat, angleUnit, this, symbol);
+}
+
 Coordinate2D<double> Expression::nextIntersection(const char * symbol, double start, double step, double max, Poincare::Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const {
   double resultAbscissa = nextIntersectionWithExpression(symbol, start, step, max,
       [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
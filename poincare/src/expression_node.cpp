@@ -2,6 +2,7 @@
 #include <poincare/expression.h>
 #include <poincare/addition.h>
 #include <poincare/arc_tangent.h>
+#include <poincare/complex.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
 #include <poincare/power.h>
@@ -144,4 +145,17 @@ Expression ExpressionNode::denominator(ReductionContext reductionContext) const
   return Expression();
 }
 
+template<typename T>
+bool ExpressionNode::templatedApproximateScalarWithEvaluation(ApproximationContext approximationContext, std::complex<T> * result) const {
+  Evaluation<T> evaluation = approximate(T(), approximationContext);
+  if (evaluation.type() != EvaluationNode<T>::Type::Complex) {
+    return false;
+  }
+  *result = static_cast<Complex<T> &>(evaluation).stdComplex();
+  return true;
+}
+
+template bool ExpressionNode::templatedApproximateScalarWithEvaluation<float>(ApproximationContext approximationContext, std::complex<float> * result) const;
+template bool ExpressionNode::templatedApproximateScalarWithEvaluation<double>(ApproximationContext approximationContext, std::complex<double> * result) const;
+
 }
@@ -24,11 +24,11 @@ int FloorNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloatM
 }
 
 template<typename T>
-Complex<T> FloorNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> FloorNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   if (c.imag() != 0) {
-    return Complex<T>::RealUndefined();
+    return std::complex<T>(NAN, 0.0);
   }
-  return Complex<T>::Builder(std::floor(c.real()));
+  return std::complex<T>(std::floor(c.real()));
 }
 
 Expression FloorNode::shallowReduce(ReductionContext reductionContext) {
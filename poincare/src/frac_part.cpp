@@ -24,11 +24,11 @@ Expression FracPartNode::shallowReduce(ReductionContext reductionContext) {
 }
 
 template<typename T>
-Complex<T> FracPartNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> FracPartNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   if (c.imag() != 0) {
-    return Complex<T>::RealUndefined();
+    return std::complex<T>(NAN, 0.0);
   }
-  return Complex<T>::Builder(c.real()-std::floor(c.real()));
+  return std::complex<T>(c.real()-std::floor(c.real()));
 }
 
 
@@ -465,6 +465,16 @@ void HorizontalLayoutNode::render(KDContext * ctx, KDPoint p, KDColor expression
 
 // HorizontalLayout
 
+HorizontalLayout HorizontalLayout::Builder(std::initializer_list<Layout> children) {
+  HorizontalLayout h = TreeHandle::NAryBuilder<HorizontalLayout, HorizontalLayoutNode>();
+  int i = 0;
+  for (Layout child : children) {
+    h.addChildAtIndexInPlace(child, i, i);
+    i++;
+  }
+  return h;
+}
+
 void HorizontalLayout::addOrMergeChildAtIndex(Layout l, int index, bool removeEmptyChildren, LayoutCursor * cursor) {
   if (l.type() == LayoutNode::Type::HorizontalLayout) {
     mergeChildrenAtIndex(HorizontalLayout(static_cast<HorizontalLayoutNode *>(l.node())), index, removeEmptyChildren, cursor);
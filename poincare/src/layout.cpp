@@ -22,7 +22,10 @@ Layout Layout::LayoutFromAddress(const void * address, size_t size) {
   if (address == nullptr || size == 0) {
     return Layout();
   }
-  return Layout(static_cast<LayoutNode *>(TreePool::sharedPool()->copyTreeFromAddress(address, size)));
+  LayoutNode * node = static_cast<LayoutNode *>(TreePool::sharedPool()->copyTreeFromAddress(address, size));
+  // The copied layout may have been a child, which cached its absolute origin
+  node->invalidAbsoluteOrigins();
+  return Layout(node);
 }
 
 int Layout::serializeParsedExpression(char * buffer, int bufferSize, Context * context) const {
@@ -75,6 +78,72 @@ Layout Layout::childAtIndex(int i) const {
 
 // Tree modification
 
+void Layout::replaceWithInPlace(Layout l) {
+  InvalidParentMetricsBeforeDetaching(*this);
+  InvalidParentMetricsBeforeDetaching(l);
+  TreeHandle::replaceWithInPlace(l);
+}
+
+void Layout::replaceChildInPlace(Layout oldChild, Layout newChild) {
+  InvalidParentMetricsBeforeDetaching(newChild);
+  TreeHandle::replaceChildInPlace(oldChild, newChild);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::replaceChildAtIndexInPlace(int oldChildIndex, Layout newChild) {
+  InvalidParentMetricsBeforeDetaching(newChild);
+  TreeHandle::replaceChildAtIndexInPlace(oldChildIndex, newChild);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::replaceChildAtIndexWithGhostInPlace(int index) {
+  TreeHandle::replaceChildAtIndexWithGhostInPlace(index);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::replaceChildWithGhostInPlace(Layout l) {
+  TreeHandle::replaceChildWithGhostInPlace(l);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::mergeChildrenAtIndexInPlace(Layout l, int i) {
+  TreeHandle::mergeChildrenAtIndexInPlace(l, i);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::swapChildrenInPlace(int i, int j) {
+  TreeHandle::swapChildrenInPlace(i, j);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::addChildAtIndexInPlace(Layout l, int index, int currentNumberOfChildren) {
+  InvalidParentMetricsBeforeDetaching(l);
+  TreeHandle::addChildAtIndexInPlace(l, index, currentNumberOfChildren);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::removeChildAtIndexInPlace(int i) {
+  TreeHandle::removeChildAtIndexInPlace(i);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::removeChildInPlace(Layout l, int childNumberOfChildren) {
+  TreeHandle::removeChildInPlace(l, childNumberOfChildren);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::removeChildrenInPlace(int currentNumberOfChildren) {
+  TreeHandle::removeChildrenInPlace(currentNumberOfChildren);
+  invalidMetricsAfterEdit();
+}
+
+void Layout::InvalidParentMetricsBeforeDetaching(Layout l) {
+  Layout p = l.parent();
+  if (!p.isUninitialized()) {
+    p.node()->invalidSizesPositionsAndBaselinesAfterEdit();
+  }
+}
+
 void Layout::replaceChild(Layout oldChild, Layout newChild, LayoutCursor * cursor, bool force) {
   int childIndex = indexOfChild(oldChild);
   assert(childIndex >= 0);
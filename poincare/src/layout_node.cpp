@@ -41,19 +41,30 @@ void LayoutNode::draw(KDContext * ctx, KDPoint p, KDColor expressionColor, KDCol
 
 KDPoint LayoutNode::absoluteOrigin() {
   LayoutNode * p = parent();
-  if (!m_positioned) {
-    if (p != nullptr) {
-      m_frame.setOrigin(p->absoluteOrigin().translatedBy(p->positionOfChild(this)));
-    } else {
-      m_frame.setOrigin(KDPointZero);
+  if (p == nullptr) {
+    return KDPointZero;
+  }
+  if (!m_absoluteOriginCached) {
+    /* The parent's origin is computed first so that the metrics its ancestors
+     * still have to discard are discarded before positioning this layout. */
+    KDPoint parentOrigin = p->absoluteOrigin();
+    p->invalidChildrenMetricsIfNeeded();
+    if (!m_positioned) {
+      m_frame.setOrigin(p->positionOfChild(this));
+      m_positioned = true;
     }
-    m_positioned = true;
+    m_absoluteOrigin = parentOrigin.translatedBy(m_frame.origin());
+    m_absoluteOriginCached = true;
   }
-  return m_frame.origin();
+  return m_absoluteOrigin;
 }
 
 KDSize LayoutNode::layoutSize() {
+  if (sizeDependsOnSiblings() && parent() != nullptr) {
+    parent()->invalidChildrenMetricsIfNeeded();
+  }
   if (!m_sized) {
+    invalidChildrenMetricsIfNeeded();
     m_frame.setSize(computeSize());
     m_sized = true;
   }
@@ -61,7 +72,11 @@ KDSize LayoutNode::layoutSize() {
 }
 
 KDCoordinate LayoutNode::baseline() {
+  if (sizeDependsOnSiblings() && parent() != nullptr) {
+    parent()->invalidChildrenMetricsIfNeeded();
+  }
   if (!m_baselined) {
+    invalidChildrenMetricsIfNeeded();
     m_baseline = computeBaseline();
     m_baselined = true;
   }
@@ -69,14 +84,54 @@ KDCoordinate LayoutNode::baseline() {
 }
 
 void LayoutNode::invalidAllSizesPositionsAndBaselines() {
-  m_sized = false;
+  invalidSizeAndBaseline();
   m_positioned = false;
-  m_baselined = false;
+  m_absoluteOriginCached = false;
   for (LayoutNode * l : children()) {
     l->invalidAllSizesPositionsAndBaselines();
   }
 }
 
+void LayoutNode::invalidSizesPositionsAndBaselinesAfterEdit() {
+  /* The metrics of a layout only depend on its descendants, and on its
+   * siblings for the layouts overriding sizeDependsOnSiblings. */
+  LayoutNode * l = this;
+  LayoutNode * root = this;
+  while (l != nullptr) {
+    l->invalidSizeAndBaseline();
+    root = l;
+    l = l->parent();
+  }
+  // Any layout of the tree may have moved
+  root->invalidAbsoluteOrigins();
+}
+
+void LayoutNode::invalidAbsoluteOrigins() {
+  m_absoluteOriginCached = false;
+  for (TreeNode * t : depthFirstChildren()) {
+    static_cast<LayoutNode *>(t)->m_absoluteOriginCached = false;
+  }
+}
+
+void LayoutNode::invalidSizeAndBaseline() {
+  m_sized = false;
+  m_baselined = false;
+  m_childrenMetricsInvalid = true;
+}
+
+void LayoutNode::invalidChildrenMetricsIfNeeded() {
+  if (!m_childrenMetricsInvalid) {
+    return;
+  }
+  m_childrenMetricsInvalid = false;
+  for (LayoutNode * l : children()) {
+    l->m_positioned = false;
+    if (l->sizeDependsOnSiblings()) {
+      l->invalidSizeAndBaseline();
+    }
+  }
+}
+
 // Tree navigation
 LayoutCursor LayoutNode::equivalentCursor(LayoutCursor * cursor) {
   // Only HorizontalLayout may have no parent, and it overloads this method
@@ -233,8 +288,9 @@ void LayoutNode::scoreCursorInDescendantsVertically (
 {
   LayoutCursor::Position * castedResultPosition = static_cast<LayoutCursor::Position *>(resultPosition);
   KDPoint cursorMiddleLeft = cursor->middleLeftPoint();
-  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? m_frame.isAbove(cursorMiddleLeft) : m_frame.isUnder(cursorMiddleLeft);
-  bool layoutContains = m_frame.contains(cursorMiddleLeft);
+  KDRect absoluteFrame(absoluteOrigin(), layoutSize());
+  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? absoluteFrame.isAbove(cursorMiddleLeft) : absoluteFrame.isUnder(cursorMiddleLeft);
+  bool layoutContains = absoluteFrame.contains(cursorMiddleLeft);
 
   if (layoutIsUnderOrAbove) {
     // Check the distance to a Left cursor.
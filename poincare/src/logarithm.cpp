@@ -110,19 +110,40 @@ template<typename U> Evaluation<U> LogarithmNode<1>::templatedApproximate(Approx
   return ApproximationHelper::Map(this, approximationContext, computeOnComplex<U>);
 }
 
+template<>
+template<typename U> bool LogarithmNode<1>::templatedApproximateScalar(ApproximationContext approximationContext, std::complex<U> * result) const {
+  return ApproximationHelper::MapScalar(this, approximationContext, computeOnComplex<U>, result);
+}
+
+template<>
+template<typename U> std::complex<U> LogarithmNode<2>::computeOnComplexWithBase(const std::complex<U> x, const std::complex<U> n, ApproximationContext approximationContext) {
+  // log(x, n) = log(x)/log(n)
+  std::complex<U> logX = ComplexNode<U>::Record(computeOnComplex(x, approximationContext.complexFormat(), approximationContext.angleUnit()));
+  std::complex<U> logN = ComplexNode<U>::Record(computeOnComplex(n, approximationContext.complexFormat(), approximationContext.angleUnit()));
+  return DivisionNode::compute<U>(logX, logN, approximationContext.complexFormat());
+}
+
 template<>
 template<typename U> Evaluation<U> LogarithmNode<2>::templatedApproximate(ApproximationContext approximationContext) const {
   Evaluation<U> x = childAtIndex(0)->approximate(U(), approximationContext);
   Evaluation<U> n = childAtIndex(1)->approximate(U(), approximationContext);
   std::complex<U> result = std::complex<U>(NAN, NAN);
   if (x.type() == EvaluationNode<U>::Type::Complex && n.type() == EvaluationNode<U>::Type::Complex) {
-    std::complex<U> xc = (static_cast<Complex<U>&>(x)).stdComplex();
-    std::complex<U> nc = (static_cast<Complex<U>&>(n)).stdComplex();
-    result = DivisionNode::compute<U>(computeOnComplex(xc, approximationContext.complexFormat(), approximationContext.angleUnit()).stdComplex(), computeOnComplex(nc, approximationContext.complexFormat(), approximationContext.angleUnit()).stdComplex(), approximationContext.complexFormat()).stdComplex();
+    result = computeOnComplexWithBase((static_cast<Complex<U>&>(x)).stdComplex(), (static_cast<Complex<U>&>(n)).stdComplex(), approximationContext);
   }
   return Complex<U>::Builder(result);
 }
 
+template<>
+template<typename U> bool LogarithmNode<2>::templatedApproximateScalar(ApproximationContext approximationContext, std::complex<U> * result) const {
+  std::complex<U> x, n;
+  if (!childAtIndex(0)->approximateScalar(U(), approximationContext, &x) || !childAtIndex(1)->approximateScalar(U(), approximationContext, &n)) {
+    return false;
+  }
+  *result = ComplexNode<U>::Record(computeOnComplexWithBase(x, n, approximationContext));
+  return true;
+}
+
 void Logarithm::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   /* We reduce the base first because of the case log(x1^y, x2) with x1 == x2.
    * When reducing x1^y, we want to be able to compare x1 of x2 so x2 need to be
@@ -416,6 +437,10 @@ template Evaluation<float> LogarithmNode<1>::templatedApproximate<float>(Approxi
 template Evaluation<double> LogarithmNode<1>::templatedApproximate<double>(ApproximationContext) const;
 template Evaluation<float> LogarithmNode<2>::templatedApproximate<float>(ApproximationContext) const;
 template Evaluation<double> LogarithmNode<2>::templatedApproximate<double>(ApproximationContext) const;
+template bool LogarithmNode<1>::templatedApproximateScalar<float>(ApproximationContext, std::complex<float> *) const;
+template bool LogarithmNode<1>::templatedApproximateScalar<double>(ApproximationContext, std::complex<double> *) const;
+template bool LogarithmNode<2>::templatedApproximateScalar<float>(ApproximationContext, std::complex<float> *) const;
+template bool LogarithmNode<2>::templatedApproximateScalar<double>(ApproximationContext, std::complex<double> *) const;
 template int LogarithmNode<1>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 template int LogarithmNode<2>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 
@@ -1,6 +1,7 @@
 #include <poincare/matrix.h>
 #include <poincare/absolute_value.h>
 #include <poincare/addition.h>
+#include <poincare/arithmetic.h>
 #include <poincare/division.h>
 #include <poincare/exception_checkpoint.h>
 #include <poincare/matrix_complex.h>
@@ -160,6 +161,38 @@ Expression Matrix::createTrace() {
   return std::move(a);
 }
 
+/* PivotRow returns the row, below row h, of the pivot for column k. With
+ * mustBeBiggest, it is the biggest coefficient in absolute value. Otherwise,
+ * threshold partial pivoting is used: the first coefficient that is not much
+ * smaller than the biggest one is chosen. This bounds the growth of the
+ * coefficients as well as partial pivoting does, while avoiding unnecessary
+ * divisions on simple matrices whose results would then be inexact. */
+template<typename T>
+static int PivotRow(const T * array, int numberOfRows, int numberOfColumns, int h, int k, bool mustBeBiggest, double * pivotAbsoluteValue) {
+  constexpr double k_pivotThreshold = 0.1;
+  int iPivot = h;
+  // Using double to stay accurate with any type T
+  double bestPivot = 0.0;
+  for (int i = h; i < numberOfRows; i++) {
+    double pivot = std::abs(array[i*numberOfColumns+k]);
+    if (pivot > bestPivot) {
+      bestPivot = pivot;
+      iPivot = i;
+    }
+  }
+  if (!mustBeBiggest) {
+    for (int i = h; i < iPivot; i++) {
+      double pivot = std::abs(array[i*numberOfColumns+k]);
+      if (pivot >= k_pivotThreshold*bestPivot) {
+        *pivotAbsoluteValue = pivot;
+        return i;
+      }
+    }
+  }
+  *pivotAbsoluteValue = bestPivot;
+  return iPivot;
+}
+
 template<typename T>
 int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
   if (numberOfRows != numberOfColumns) {
@@ -167,37 +200,115 @@ int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
   }
   assert(numberOfRows*numberOfColumns <= k_maxNumberOfCoefficients);
   int dim = numberOfRows;
-  /* Create the matrix inv = (A|I) with A the input matrix and I the dim identity matrix
-   * (A is squared with less than k_maxNumberOfCoefficients so (A|I) has less than
-   * 2*k_maxNumberOfCoefficients */
-  T operands[2*k_maxNumberOfCoefficients];
+  T lu[k_maxNumberOfCoefficients];
+  for (int i = 0; i < dim*dim; i++) {
+    // Using abs function to be compatible with both double and std::complex
+    if (!std::isfinite(std::abs(array[i]))) {
+      return -2;
+    }
+    lu[i] = array[i];
+  }
+  int permutation[k_maxNumberOfCoefficients];
+  bool permutationIsOdd;
+  if (!ArrayLUDecompose(lu, dim, permutation, &permutationIsOdd)) {
+    return -2;
+  }
+  /* P*A = L*U so A^-1 = U^-1*L^-1*P. Both triangular solves are done row by
+   * row, on contiguous rows of the array. */
   for (int i = 0; i < dim; i++) {
+    T * row = array + i*dim;
     for (int j = 0; j < dim; j++) {
-      T cell = array[i*numberOfColumns+j];
-      // Using abs function to be compatible with both double and std::complex
-      if (!std::isfinite(std::abs(cell))) {
+      row[j] = permutation[i] == j ? (T)1.0 : (T)0.0;
+    }
+    for (int l = 0; l < i; l++) {
+      T factor = lu[i*dim+l];
+      if (factor == (T)0.0) {
+        continue;
+      }
+      const T * previousRow = array + l*dim;
+      for (int j = 0; j < dim; j++) {
+        row[j] -= factor*previousRow[j];
+      }
+    }
+  }
+  for (int i = dim-1; i >= 0; i--) {
+    T * row = array + i*dim;
+    for (int l = i+1; l < dim; l++) {
+      T factor = lu[i*dim+l];
+      if (factor == (T)0.0) {
+        continue;
+      }
+      const T * nextRow = array + l*dim;
+      for (int j = 0; j < dim; j++) {
+        row[j] -= factor*nextRow[j];
+      }
+    }
+    T pivot = lu[i*dim+i];
+    for (int j = 0; j < dim; j++) {
+      row[j] /= pivot;
+      if (!std::isfinite(std::abs(row[j]))) {
         return -2;
       }
-      operands[i*2*dim+j] = cell;
     }
-    for (int j = dim; j < 2*dim; j++) {
-      operands[i*2*dim+j] = j-dim == i ? 1.0 : 0.0;
+  }
+  return 0;
+}
+
+template<typename T>
+T Matrix::ArrayDeterminant(T * array, int dim) {
+  assert(dim*dim <= k_maxNumberOfCoefficients);
+  for (int i = 0; i < dim*dim; i++) {
+    if (std::isnan(std::abs(array[i]))) {
+      return NAN;
     }
   }
-  ArrayRowCanonize(operands, dim, 2*dim);
-  // Check invertibility
+  int permutation[k_maxNumberOfCoefficients];
+  bool permutationIsOdd;
+  if (!ArrayLUDecompose(array, dim, permutation, &permutationIsOdd)) {
+    return (T)0.0;
+  }
+  T determinant = permutationIsOdd ? (T)-1.0 : (T)1.0;
   for (int i = 0; i < dim; i++) {
-    T cell = operands[i*2*dim+i];
-    if (!std::isfinite(std::abs(cell)) || std::abs(cell - (T)1.0) > Expression::Epsilon<float>()) {
-      return -2;
-    }
+    determinant *= array[i*dim+i];
   }
+  return determinant;
+}
+
+template<typename T>
+bool Matrix::ArrayLUDecompose(T * array, int dim, int * permutation, bool * permutationIsOdd) {
+  *permutationIsOdd = false;
   for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      array[i*numberOfColumns+j] = operands[i*2*dim+j+dim];
+    permutation[i] = i;
+  }
+  for (int k = 0; k < dim; k++) {
+    double bestPivot;
+    int iPivot = PivotRow(array, dim, dim, k, k, false, &bestPivot);
+    if (!(bestPivot >= DBL_MIN)) {
+      // No non-null coefficient in this column: the array is singular
+      return false;
+    }
+    if (iPivot != k) {
+      for (int col = 0; col < dim; col++) {
+        std::swap(array[iPivot*dim+col], array[k*dim+col]);
+      }
+      std::swap(permutation[iPivot], permutation[k]);
+      *permutationIsOdd = !*permutationIsOdd;
+    }
+    const T * pivotRow = array + k*dim;
+    T pivot = pivotRow[k];
+    for (int i = k+1; i < dim; i++) {
+      T * row = array + i*dim;
+      T factor = row[k] / pivot;
+      row[k] = factor;
+      if (factor == (T)0.0) {
+        continue;
+      }
+      for (int j = k+1; j < dim; j++) {
+        row[j] -= factor*pivotRow[j];
+      }
     }
   }
-  return 0;
+  return true;
 }
 
 Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant, bool reduced) {
@@ -205,6 +316,10 @@ Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Ex
   // The matrix children have to be reduced to be able to spot 0
   deepReduceChildren(reductionContext);
 
+  if (rationalRowCanonize(determinant, reduced)) {
+    return *this;
+  }
+
   Multiplication det = Multiplication::Builder();
 
   int m = numberOfRows();
@@ -301,31 +416,174 @@ Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Ex
   return *this;
 }
 
-template<typename T>
-void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * determinant, bool reduced) {
+bool Matrix::rationalRowCanonize(Expression * determinant, bool reduced) {
+  int m = numberOfRows();
+  int n = numberOfColumns();
+  if (m*n > k_maxNumberOfRationalCoefficients) {
+    return false;
+  }
+  for (int i = 0; i < m*n; i++) {
+    if (childAtIndex(i).type() != ExpressionNode::Type::Rational) {
+      return false;
+    }
+  }
+  /* Each row is multiplied by the lcm of its denominators to get an integer
+   * matrix D*A. Row operations commute with the row scaling: the Gaussian
+   * elimination of D*A is D times the one of A, so the pivots are chosen by
+   * comparing |coefficient|/scale. */
+  Integer coefficients[k_maxNumberOfRationalCoefficients];
+  Integer scales[k_maxNumberOfRationalCoefficients];
+  for (int i = 0; i < m; i++) {
+    Integer scale(1);
+    for (int j = 0; j < n; j++) {
+      scale = Arithmetic::LCM(scale, matrixChild(i, j).convert<Rational>().integerDenominator());
+    }
+    if (scale.isOverflow()) {
+      return false;
+    }
+    scales[i] = scale;
+    for (int j = 0; j < n; j++) {
+      Rational r = matrixChild(i, j).convert<Rational>();
+      coefficients[i*n+j] = Integer::Multiplication(r.signedIntegerNumerator(), Integer::Division(scale, r.integerDenominator()).quotient);
+      if (coefficients[i*n+j].isOverflow()) {
+        return false;
+      }
+    }
+  }
+
+  /* Bareiss algorithm: each elimination step is divided by the previous pivot,
+   * which is exact. Coefficients thus remain minors of D*A and do not blow up.
+   * When computing the reduced form, rows above the pivot are eliminated the
+   * same way (fraction-free Gauss-Jordan), and all pivots end up equal. */
+  Integer previousPivot(1);
+  bool nullDeterminant = false;
+  bool negativeDeterminant = false;
   int h = 0; // row pivot
   int k = 0; // column pivot
-
-  while (h < numberOfRows && k < numberOfColumns) {
-    // Find the biggest pivot (in absolute value). See comment on rowCanonize.
-    int iPivot_temp = h;
-    int iPivot = h;
-    // Using double to stay accurate with any type T
-    double bestPivot = 0.0;
-    while (iPivot_temp < numberOfRows) {
-      double pivot = std::abs(array[iPivot_temp*numberOfColumns+k]);
-      if (pivot > bestPivot) {
-        // Update best pivot
-        bestPivot = pivot;
-        iPivot = iPivot_temp;
+  while (h < m && k < n) {
+    // See comment on pivot selection in rowCanonize
+    int iPivot = -1;
+    for (int i = h; i < m; i++) {
+      if (coefficients[i*n+k].isZero()) {
+        continue;
+      }
+      if (iPivot < 0) {
+        iPivot = i;
         if (reduced) {
-          /* In reduced form, taking the first non null pivot is enough, and
-           * more efficient. */
           break;
         }
+        continue;
       }
-      iPivot_temp++;
+      // |c_ik|/d_i > |c_iPivotk|/d_iPivot
+      Integer candidate = Integer::Multiplication(coefficients[i*n+k], scales[iPivot]);
+      Integer best = Integer::Multiplication(coefficients[iPivot*n+k], scales[i]);
+      if (candidate.isOverflow() || best.isOverflow()) {
+        return false;
+      }
+      candidate.setNegative(false);
+      best.setNegative(false);
+      if (best.isLowerThan(candidate)) {
+        iPivot = i;
+      }
+    }
+    if (iPivot < 0) {
+      // No non-null coefficient in this column, skip
+      k++;
+      nullDeterminant = true;
+      continue;
+    }
+    if (iPivot != h) {
+      for (int col = 0; col < n; col++) {
+        Integer temp = coefficients[iPivot*n+col];
+        coefficients[iPivot*n+col] = coefficients[h*n+col];
+        coefficients[h*n+col] = temp;
+      }
+      Integer temp = scales[iPivot];
+      scales[iPivot] = scales[h];
+      scales[h] = temp;
+      negativeDeterminant = !negativeDeterminant;
+    }
+    Integer pivot = coefficients[h*n+k];
+    for (int i = reduced ? 0 : h + 1; i < m; i++) {
+      if (i == h) { continue; }
+      Integer factor = coefficients[i*n+k];
+      for (int j = reduced ? 0 : k + 1; j < n; j++) {
+        if (j == k) { continue; }
+        Integer c = Integer::Subtraction(Integer::Multiplication(pivot, coefficients[i*n+j]), Integer::Multiplication(factor, coefficients[h*n+j]));
+        if (c.isOverflow()) {
+          return false;
+        }
+        if (!previousPivot.isOne()) {
+          IntegerDivision division = Integer::Division(c, previousPivot);
+          if (!division.remainder.isZero()) {
+            return false;
+          }
+          c = division.quotient;
+        }
+        coefficients[i*n+j] = c;
+      }
+      coefficients[i*n+k] = Integer(0);
     }
+    previousPivot = pivot;
+    h++;
+    k++;
+  }
+
+  Expression det;
+  if (determinant) {
+    if (nullDeterminant || h < m) {
+      det = Rational::Builder(0);
+    } else {
+      /* The last pivot is the determinant of P*D*A, where P is the permutation
+       * of the rows. */
+      Integer scalesProduct(1);
+      for (int i = 0; i < m; i++) {
+        scalesProduct = Integer::Multiplication(scalesProduct, scales[i]);
+      }
+      if (scalesProduct.isOverflow()) {
+        return false;
+      }
+      previousPivot.setNegative(previousPivot.isNegative() != negativeDeterminant);
+      det = Rational::Builder(previousPivot, scalesProduct);
+    }
+  }
+
+  // Pivot rows are divided by their pivot, which is their first non-null coefficient
+  for (int i = 0; i < m; i++) {
+    Integer pivot(1);
+    for (int j = 0; j < n; j++) {
+      if (!coefficients[i*n+j].isZero()) {
+        pivot = coefficients[i*n+j];
+        break;
+      }
+    }
+    for (int j = 0; j < n; j++) {
+      if (coefficients[i*n+j].isZero()) {
+        // Avoid a negative zero when the pivot is negative
+        replaceChildAtIndexInPlace(i*n+j, Rational::Builder(0));
+        continue;
+      }
+      // Rational::Builder simplifies its arguments in place
+      Integer numerator = coefficients[i*n+j];
+      Integer denominator = pivot;
+      replaceChildAtIndexInPlace(i*n+j, Rational::Builder(numerator, denominator));
+    }
+  }
+  if (determinant) {
+    *determinant = det;
+  }
+  return true;
+}
+
+template<typename T>
+void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * determinant, bool reduced) {
+  int h = 0; // row pivot
+  int k = 0; // column pivot
+
+  while (h < numberOfRows && k < numberOfColumns) {
+    // See comment on rowCanonize and on PivotRow
+    double bestPivot;
+    int iPivot = PivotRow(array, numberOfRows, numberOfColumns, h, k, !reduced, &bestPivot);
     if (bestPivot < DBL_MIN) {
       // No non-null coefficient in this column, skip
       k++;
@@ -356,13 +614,15 @@ void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns,
       /* Set to 0 all M[i][j] i != h, j > k by linear combination. If a
        * non-reduced form is computed (ref), only rows below the pivot are
        * reduced, i > h as well */
+      const T * pivotRow = array + h*numberOfColumns;
       for (int i = l; i < numberOfRows; i++) {
-        if (i == h) { continue; }
-        T factor = array[i*numberOfColumns+k];
+        T * row = array + i*numberOfColumns;
+        T factor = row[k];
+        if (i == h || factor == (T)0.0) { continue; }
         for (int j = k+1; j < numberOfColumns; j++) {
-          array[i*numberOfColumns+j] -= array[h*numberOfColumns+j]*factor;
+          row[j] -= pivotRow[j]*factor;
         }
-        array[i*numberOfColumns+k] = 0;
+        row[k] = 0;
       }
       h++;
       k++;
@@ -618,6 +878,8 @@ Expression Matrix::computeInverseOrDeterminant(bool computeDeterminant, Expressi
 
 
 template int Matrix::ArrayInverse<double>(double *, int, int);
+template std::complex<float> Matrix::ArrayDeterminant<std::complex<float>>(std::complex<float> *, int);
+template std::complex<double> Matrix::ArrayDeterminant<std::complex<double>>(std::complex<double> *, int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *, int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *, int, int);
 template void Matrix::ArrayRowCanonize<std::complex<float> >(std::complex<float>*, int, int, std::complex<float>*, bool);
@@ -78,9 +78,7 @@ std::complex<T> MatrixComplexNode<T>::determinant() const {
   for (int i = 0; i < numberOfChildren(); i++) {
     operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
   }
-  std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant);
-  return determinant;
+  return Matrix::ArrayDeterminant(operandsCopy, m_numberOfRows);
 }
 
 template<typename T>
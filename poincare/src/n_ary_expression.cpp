@@ -1,29 +1,107 @@
 #include <poincare/n_ary_expression.h>
 #include <poincare/rational.h>
+#include <poincare/tree_pool.h>
 extern "C" {
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 }
+#include <algorithm>
 #include <utility>
 
 namespace Poincare {
 
 void NAryExpressionNode::sortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices, bool canBeInterrupted) {
+  const int childrenCount = numberOfChildren();
+  if (childrenCount > k_maxNumberOfChildrenSortedByIndex) {
+    sortChildrenInPoolInPlace(order, context, canSwapMatrices, canBeInterrupted);
+    return;
+  }
+  /* The children do not move in the pool while they are sorted, so their
+   * addresses and matrix statuses are computed once. */
+  const ExpressionNode * childNodes[k_maxNumberOfChildrenSortedByIndex];
+  bool isMatrix[k_maxNumberOfChildrenSortedByIndex];
+  uint8_t sortedIndexes[k_maxNumberOfChildrenSortedByIndex];
+  uint8_t mergeBuffer[k_maxNumberOfChildrenSortedByIndex];
+  static_assert(k_maxNumberOfChildrenSortedByIndex <= UINT8_MAX + 1, "Children indexes do not fit in uint8_t");
+  int index = 0;
+  for (ExpressionNode * c : children()) {
+    childNodes[index] = c;
+    isMatrix[index] = Expression(c).deepIsMatrix(context);
+    sortedIndexes[index] = index;
+    index++;
+  }
+
+  /* Bottom-up merge sort. A child of the right run is only taken first if the
+   * child of the left run must come after it, which keeps the sort stable, as
+   * the bubble sort it replaces was. */
+  uint8_t * source = sortedIndexes;
+  uint8_t * destination = mergeBuffer;
+  for (int width = 1; width < childrenCount; width *= 2) {
+    for (int start = 0; start < childrenCount; start += 2 * width) {
+      int middle = std::min(start + width, childrenCount);
+      int end = std::min(start + 2 * width, childrenCount);
+      int left = start;
+      int right = middle;
+      for (int k = start; k < end; k++) {
+        if (left < middle && (right >= end || !ChildMustComeAfter(childNodes[source[left]], isMatrix[source[left]], childNodes[source[right]], isMatrix[source[right]], order, canSwapMatrices, canBeInterrupted))) {
+          destination[k] = source[left++];
+        } else {
+          destination[k] = source[right++];
+        }
+      }
+    }
+    uint8_t * swap = source;
+    source = destination;
+    destination = swap;
+  }
+
+  /* Apply the permutation: each child which is not at its place is moved in
+   * front of the child occupying it, in a single pool move.
+   * currentIndexes[i] is the original index of the child now at position i. */
+  uint8_t * currentIndexes = destination;
+  for (int i = 0; i < childrenCount; i++) {
+    currentIndexes[i] = i;
+  }
+  TreeNode * childAtPosition = childAtIndex(0);
+  for (int i = 0; i < childrenCount; i++) {
+    int position = i;
+    while (currentIndexes[position] != source[i]) {
+      position++;
+    }
+    if (position != i) {
+      TreeNode * child = childAtPosition;
+      for (int j = i; j < position; j++) {
+        child = child->nextSibling();
+      }
+      TreePool::sharedPool()->move(childAtPosition, child, child->numberOfChildren());
+      memmove(currentIndexes + i + 1, currentIndexes + i, position - i);
+      currentIndexes[i] = source[i];
+    }
+    // The moved child now starts where the child at position i was
+    childAtPosition = childAtPosition->nextSibling();
+  }
+}
+
+bool NAryExpressionNode::ChildMustComeAfter(const ExpressionNode * c1, bool c1IsMatrix, const ExpressionNode * c2, bool c2IsMatrix, ExpressionOrder order, bool canSwapMatrices, bool canBeInterrupted) {
+  /* Warning: Matrix operations are not always commutative (ie,
+   * multiplication) so we never swap 2 matrices. */
+  if (c1IsMatrix != c2IsMatrix) {
+    // we always put matrices at the end of expressions
+    return c1IsMatrix;
+  }
+  return (!c1IsMatrix || canSwapMatrices) && order(c1, c2, canBeInterrupted) > 0;
+}
+
+void NAryExpressionNode::sortChildrenInPoolInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices, bool canBeInterrupted) {
   Expression reference(this);
   const int childrenCount = reference.numberOfChildren();
   for (int i = 1; i < childrenCount; i++) {
     bool isSorted = true;
     for (int j = 0; j < childrenCount-1; j++) {
-      /* Warning: Matrix operations are not always commutative (ie,
-       * multiplication) so we never swap 2 matrices. */
       ExpressionNode * cj = childAtIndex(j);
       ExpressionNode * cj1 = childAtIndex(j+1);
-      bool cjIsMatrix = Expression(cj).deepIsMatrix(context);
-      bool cj1IsMatrix = Expression(cj1).deepIsMatrix(context);
-      bool cj1GreaterThanCj = order(cj, cj1, canBeInterrupted) > 0;
-      if ((cjIsMatrix && !cj1IsMatrix) || // we always put matrices at the end of expressions
-          (cjIsMatrix && cj1IsMatrix && canSwapMatrices && cj1GreaterThanCj) ||
-          (!cjIsMatrix && !cj1IsMatrix && cj1GreaterThanCj)) {
+      if (ChildMustComeAfter(cj, Expression(cj).deepIsMatrix(context), cj1, Expression(cj1).deepIsMatrix(context), order, canSwapMatrices, canBeInterrupted)) {
         reference.swapChildrenInPlace(j, j+1);
         isSorted = false;
       }
@@ -48,12 +48,12 @@ Evaluation<T> NthRootNode::templatedApproximate(ApproximationContext approximati
      * correspond to the principale angle. */
     if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real && indexc.imag() == 0.0 && std::round(indexc.real()) == indexc.real()) {
       // root(x, q) with q integer and x real
-      Complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(basec, (T)1.0, indexc.real());
-       if (!result.isUndefined()) {
-         return std::move(result);
+      std::complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(basec, (T)1.0, indexc.real());
+       if (!std::isnan(result.real()) || !std::isnan(result.imag())) {
+         return Complex<T>::Builder(result);
        }
     }
-    result = PowerNode::compute(basec, std::complex<T>(1.0)/(indexc), approximationContext.complexFormat());
+    result = Complex<T>::Builder(PowerNode::compute(basec, std::complex<T>(1.0)/(indexc), approximationContext.complexFormat()));
   }
   return std::move(result);
 }
@@ -0,0 +1,52 @@
+#ifndef POINCARE_PARSING_IDENTIFIER_TABLE_H
+#define POINCARE_PARSING_IDENTIFIER_TABLE_H
+
+#include "token.h"
+
+/* Reserved identifiers (function names, special identifiers, unit symbols and
+ * prefixes) are stored in tables sorted by name, in the order of strcmp.
+ * The order is checked at compile time with IsSorted, so that identifiers can
+ * be looked up with a binary search instead of being compared one after the
+ * other. */
+
+namespace Poincare {
+
+namespace IdentifierTable {
+
+constexpr bool NamesAreOrdered(const char * name1, const char * name2, bool strictly) {
+  // strcmp compares characters as unsigned char
+  return *name1 == *name2 ?
+    (*name1 != 0 ? NamesAreOrdered(name1 + 1, name2 + 1, strictly) : !strictly) :
+    static_cast<unsigned char>(*name1) < static_cast<unsigned char>(*name2);
+}
+
+template<typename T>
+constexpr bool IsSorted(const T * table, int length, const char * (*nameOf)(T), bool strictly) {
+  return length <= 1 || (NamesAreOrdered(nameOf(table[0]), nameOf(table[1]), strictly) && IsSorted(table + 1, length - 1, nameOf, strictly));
+}
+
+/* Find returns the first entry of the table with the given name, or nullptr if
+ * there is none. */
+template<typename T>
+const T * Find(const T * table, int length, const char * name, size_t nameLength, const char * (*nameOf)(T)) {
+  int lower = 0;
+  int upper = length;
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (Token::CompareNonNullTerminatedName(name, nameLength, nameOf(table[middle])) > 0) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  if (lower < length && Token::CompareNonNullTerminatedName(name, nameLength, nameOf(table[lower])) == 0) {
+    return table + lower;
+  }
+  return nullptr;
+}
+
+}
+
+}
+
+#endif
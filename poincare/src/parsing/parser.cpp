@@ -7,6 +7,7 @@
 namespace Poincare {
 
 constexpr const Expression::FunctionHelper * Parser::s_reservedFunctions[];
+constexpr Parser::SpecialIdentifier Parser::s_specialIdentifiers[];
 
 Expression Parser::parse() {
   Expression result = parseUntil(Token::EndOfStream);
@@ -19,40 +20,20 @@ Expression Parser::parse() {
 
 bool Parser::IsReservedName(const char * name, size_t nameLength) {
   return GetReservedFunction(name, nameLength) != nullptr
-    || IsSpecialIdentifierName(name, nameLength);
+    || GetSpecialIdentifier(name, nameLength) != nullptr;
 }
 
 // Private
 
 const Expression::FunctionHelper * const * Parser::GetReservedFunction(const char * name, size_t nameLength) {
-  const Expression::FunctionHelper * const * reservedFunction = s_reservedFunctions;
-  while (reservedFunction < s_reservedFunctionsUpperBound) {
-    int nameDifference = Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name());
-    if (nameDifference == 0) {
-      return reservedFunction;
-    }
-    if (nameDifference < 0) {
-      break;
-    }
-    reservedFunction++;
-  }
-  return nullptr;
+  static_assert(IdentifierTable::IsSorted(s_reservedFunctions, k_numberOfReservedFunctions, &ReservedFunctionName, false), "Parser::s_reservedFunctions must be ordered according to name");
+  return IdentifierTable::Find(s_reservedFunctions, k_numberOfReservedFunctions, name, nameLength, &ReservedFunctionName);
 }
 
-bool Parser::IsSpecialIdentifierName(const char * name, size_t nameLength) {
+const Parser::SpecialIdentifier * Parser::GetSpecialIdentifier(const char * name, size_t nameLength) {
   // TODO Avoid special cases if possible
-  return (
-    Token::CompareNonNullTerminatedName(name, nameLength, Symbol::k_ans)     == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Infinity::Name())  == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "inf")             == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "infinity")        == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "oo")              == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Undefined::Name()) == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Unreal::Name())    == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "u")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "v")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "w")               == 0
-  );
+  static_assert(IdentifierTable::IsSorted(s_specialIdentifiers, k_numberOfSpecialIdentifiers, &SpecialIdentifierName, true), "Parser::s_specialIdentifiers must be strictly ordered according to name");
+  return IdentifierTable::Find(s_specialIdentifiers, k_numberOfSpecialIdentifiers, name, nameLength, &SpecialIdentifierName);
 }
 
 Expression Parser::parseUntil(Token::Type stoppingType) {
@@ -436,26 +417,22 @@ void Parser::parseSequence(Expression & leftHandSide, const char * name, Token::
   }
 }
 
-void Parser::parseSpecialIdentifier(Expression & leftHandSide) {
-  if (m_currentToken.compareTo(Symbol::k_ans) == 0) {
+void Parser::parseSpecialIdentifier(Expression & leftHandSide, const SpecialIdentifier * specialIdentifier) {
+  switch (specialIdentifier->type) {
+  case SpecialIdentifier::Type::Ans:
     leftHandSide = Symbol::Ans();
-  } else if (m_currentToken.compareTo(Infinity::Name()) == 0 ||
-             m_currentToken.compareTo("inf")            == 0 ||
-             m_currentToken.compareTo("infinity")       == 0 ||
-             m_currentToken.compareTo("oo")             == 0
-    ) {
-
-    leftHandSide = Infinity::Builder(false);
-  } else if (m_currentToken.compareTo("inf") == 0) {
+    return;
+  case SpecialIdentifier::Type::Infinity:
     leftHandSide = Infinity::Builder(false);
-  } else if (m_currentToken.compareTo(Undefined::Name()) == 0) {
+    return;
+  case SpecialIdentifier::Type::Undefined:
     leftHandSide = Undefined::Builder();
-  } else if (m_currentToken.compareTo(Unreal::Name()) == 0) {
+    return;
+  case SpecialIdentifier::Type::Unreal:
     leftHandSide = Unreal::Builder();
-  } else {
-    assert(m_currentToken.compareTo("u") == 0
-        || m_currentToken.compareTo("v") == 0
-        || m_currentToken.compareTo("w") == 0);
+    return;
+  default:
+    assert(specialIdentifier->type == SpecialIdentifier::Type::Sequence);
     /* Special case for sequences (e.g. "u(n)", "u{n}", ...)
      * We know that m_currentToken.text()[0] is either 'u', 'v' or 'w', so we do
      * not need to pass a code point to parseSequence. */
@@ -520,10 +497,13 @@ void Parser::parseIdentifier(Expression & leftHandSide, Token::Type stoppingType
   const Expression::FunctionHelper * const * functionHelper = GetReservedFunction(m_currentToken.text(), m_currentToken.length());
   if (functionHelper != nullptr) {
     parseReservedFunction(leftHandSide, functionHelper);
-  } else if (IsSpecialIdentifierName(m_currentToken.text(), m_currentToken.length())) {
-    parseSpecialIdentifier(leftHandSide);
   } else {
-    parseCustomIdentifier(leftHandSide, m_currentToken.text(), m_currentToken.length());
+    const SpecialIdentifier * specialIdentifier = GetSpecialIdentifier(m_currentToken.text(), m_currentToken.length());
+    if (specialIdentifier != nullptr) {
+      parseSpecialIdentifier(leftHandSide, specialIdentifier);
+    } else {
+      parseCustomIdentifier(leftHandSide, m_currentToken.text(), m_currentToken.length());
+    }
   }
   isThereImplicitMultiplication();
 }
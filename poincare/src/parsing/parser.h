@@ -8,6 +8,7 @@
  *   an efficient but less readable shunting-yard parser. */
 
 #include <poincare_nodes.h>
+#include "identifier_table.h"
 #include "tokenizer.h"
 
 namespace Poincare {
@@ -35,8 +36,22 @@ public:
   static bool IsReservedName(const char * name, size_t nameLength);
 
 private:
+  struct SpecialIdentifier {
+    enum class Type {
+      Ans,
+      Infinity,
+      Undefined,
+      Unreal,
+      Sequence
+    };
+    const char * name;
+    Type type;
+  };
+
+  constexpr static const char * SpecialIdentifierName(SpecialIdentifier identifier) { return identifier.name; }
+  constexpr static const char * ReservedFunctionName(const Expression::FunctionHelper * functionHelper) { return functionHelper->name(); }
   static const Expression::FunctionHelper * const * GetReservedFunction(const char * name, size_t nameLength);
-  static bool IsSpecialIdentifierName(const char * name, size_t nameLength);
+  static const SpecialIdentifier * GetSpecialIdentifier(const char * name, size_t nameLength);
 
   Expression parseUntil(Token::Type stoppingType);
 
@@ -75,7 +90,7 @@ private:
   Expression parseFunctionParameters();
   Expression parseCommaSeparatedList();
   void parseReservedFunction(Expression & leftHandSide, const Expression::FunctionHelper * const * functionHelper);
-  void parseSpecialIdentifier(Expression & leftHandSide);
+  void parseSpecialIdentifier(Expression & leftHandSide, const SpecialIdentifier * specialIdentifier);
   void parseSequence(Expression & leftHandSide, const char * name, Token::Type leftDelimiter1, Token::Type rightDelimiter1, Token::Type leftDelimiter2, Token::Type rightDelimiter2);
   void parseCustomIdentifier(Expression & leftHandSide, const char * name, size_t length);
   void defaultParseLeftParenthesis(bool isSystemParenthesis, Expression & leftHandSide, Token::Type stoppingType);
@@ -158,11 +173,28 @@ private:
     &MatrixTranspose::s_functionHelper,
     &SquareRoot::s_functionHelper
   };
-  static constexpr const Expression::FunctionHelper * const * s_reservedFunctionsUpperBound = s_reservedFunctions + (sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *));
-  /* The method GetReservedFunction passes through the successive
-   * entries of the above array in order to determine whether m_currentToken
-   * corresponds to an entry. As a helper, the static constexpr
-   * s_reservedFunctionsUpperBound marks the end of the array. */
+  static constexpr int k_numberOfReservedFunctions = sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *);
+  static constexpr const Expression::FunctionHelper * const * s_reservedFunctionsUpperBound = s_reservedFunctions + k_numberOfReservedFunctions;
+  /* The method GetReservedFunction looks for m_currentToken in the above
+   * array with a binary search. It returns the first entry with that name, and
+   * the entries with the same name but more children follow it. As a helper,
+   * the static constexpr s_reservedFunctionsUpperBound marks the end of the
+   * array. */
+
+  // The array of special identifiers, ordered according to name
+  static constexpr SpecialIdentifier s_specialIdentifiers[] = {
+    {Symbol::k_ans, SpecialIdentifier::Type::Ans},
+    {"inf", SpecialIdentifier::Type::Infinity},
+    {"infinity", SpecialIdentifier::Type::Infinity},
+    {"oo", SpecialIdentifier::Type::Infinity},
+    {"u", SpecialIdentifier::Type::Sequence},
+    {Undefined::Name(), SpecialIdentifier::Type::Undefined},
+    {Unreal::Name(), SpecialIdentifier::Type::Unreal},
+    {"v", SpecialIdentifier::Type::Sequence},
+    {"w", SpecialIdentifier::Type::Sequence},
+    {Infinity::Name(), SpecialIdentifier::Type::Infinity}
+  };
+  static constexpr int k_numberOfSpecialIdentifiers = sizeof(s_specialIdentifiers)/sizeof(SpecialIdentifier);
 };
 
 }
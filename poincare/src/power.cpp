@@ -145,7 +145,7 @@ bool PowerNode::childAtIndexNeedsUserParentheses(const Expression & child, int c
 // Private
 
 template<typename T>
-Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
+std::complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
   // Assert p and q are in fact integers
   assert(std::round(p) == p);
   assert(std::round(q) == q);
@@ -161,17 +161,17 @@ Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::comple
     std::complex<T> absc = c;
     absc.real(std::fabs(absc.real()));
     // compute |c|^(p/q) which is a real
-    Complex<T> absCPowD = PowerNode::compute(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real);
+    std::complex<T> absCPowD = PowerNode::compute(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real);
     /* As q is odd, c^(p/q) = (sign(c)^(1/q))^p * |c|^(p/q)
      *                      = sign(c)^p         * |c|^(p/q)
      *                      = -|c|^(p/q) iff c < 0 and p odd */
-    return c.real() < (T)0.0 && std::pow((T)-1.0, p) < (T)0.0 ? Complex<T>::Builder(-absCPowD.stdComplex()) : absCPowD;
+    return c.real() < (T)0.0 && std::pow((T)-1.0, p) < (T)0.0 ? -absCPowD : absCPowD;
   }
-  return Complex<T>::Undefined();
+  return std::complex<T>(NAN, NAN);
 }
 
 template<typename T>
-Complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+std::complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
   std::complex<T> result;
   if (c.imag() == (T)0.0 && d.imag() == (T)0.0 && c.real() != (T)0.0 && (c.real() > (T)0.0 || std::round(d.real()) == d.real())) {
     /* pow: (R+, R) -> R+ (2^1.3 ~ 2.46)
@@ -200,7 +200,7 @@ Complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d,
    * so arg(c^d) = y*ln(r)+xθ.
    * We consider that arg[π] is negligible if it is negligible compared to
    * norm(d) = sqrt(x^2+y^2) and ln(r) = ln(norm(c)).*/
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false));
+  return ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false);
 }
 
 // Layout
@@ -309,48 +309,64 @@ template<typename T> MatrixComplex<T> PowerNode::computeOnMatrices(const MatrixC
   return MatrixComplex<T>::Undefined();
 }
 
+template<typename T> bool PowerNode::approximateRationalIndex(T * p, T * q) const {
+  // If the power has been reduced, we look for a rational index
+  if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
+    *p = r->signedNumerator().approximate<T>();
+    *q = r->denominator().approximate<T>();
+    return true;
+  }
+  /* If the power has been simplified (reduced + beautified), we look for an
+   * index of the for Division(Rational,Rational). */
+  if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
+    const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
+    if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
+      return false;
+    }
+    *p = pRat->signedNumerator().approximate<T>();
+    *q = qRat->signedNumerator().approximate<T>();
+    return true;
+  }
+  /* We don't handle power that haven't been reduced or simplified as the
+   * index can take to many forms and still be equivalent to p/q,
+   * with p, q integers. */
+  return false;
+}
+
 template<typename T> Evaluation<T> PowerNode::templatedApproximate(ApproximationContext approximationContext) const {
   /* Special case: c^(p/q) with p, q integers
    * In real mode, c^(p/q) might have a real root which is not the principal
    * root. We return this value in that case to avoid returning "unreal". */
-  if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real) {
+  T p, q;
+  if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real && approximateRationalIndex(&p, &q)) {
     Evaluation<T> base = childAtIndex(0)->approximate(T(), approximationContext);
-    if (base.type() != EvaluationNode<T>::Type::Complex) {
-      goto defaultApproximation;
-    }
-    std::complex<T> c = static_cast<Complex<T> &>(base).stdComplex();
-    T p = NAN;
-    T q = NAN;
-    // If the power has been reduced, we look for a rational index
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
-      p = r->signedNumerator().approximate<T>();
-      q = r->denominator().approximate<T>();
-    }
-    /* If the power has been simplified (reduced + beautified), we look for an
-     * index of the for Division(Rational,Rational). */
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
-      const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
-      if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
-        goto defaultApproximation;
+    if (base.type() == EvaluationNode<T>::Type::Complex) {
+      std::complex<T> result = computeNotPrincipalRealRootOfRationalPow(static_cast<Complex<T> &>(base).stdComplex(), p, q);
+      if (!std::isnan(result.real()) || !std::isnan(result.imag())) {
+        return Complex<T>::Builder(result);
       }
-      p = pRat->signedNumerator().approximate<T>();
-      q = qRat->signedNumerator().approximate<T>();
     }
-    /* We don't handle power that haven't been reduced or simplified as the
-     * index can take to many forms and still be equivalent to p/q,
-     * with p, q integers. */
-    if (std::isnan(p) || std::isnan(q)) {
-      goto defaultApproximation;
+  }
+  return ApproximationHelper::MapReduce<T>(this, approximationContext, compute<T>, computeOnComplexAndMatrix<T>, computeOnMatrixAndComplex<T>, computeOnMatrices<T>);
+}
+
+template<typename T> bool PowerNode::templatedApproximateScalar(ApproximationContext approximationContext, std::complex<T> * result) const {
+  // Same special case as in templatedApproximate
+  T p, q;
+  if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real && approximateRationalIndex(&p, &q)) {
+    std::complex<T> base;
+    if (!childAtIndex(0)->approximateScalar(T(), approximationContext, &base)) {
+      return false;
     }
-    Complex<T> result = computeNotPrincipalRealRootOfRationalPow(c, p, q);
-    if (!result.isUndefined()) {
-      return std::move(result);
+    std::complex<T> root = computeNotPrincipalRealRootOfRationalPow(base, p, q);
+    if (!std::isnan(root.real()) || !std::isnan(root.imag())) {
+      *result = ComplexNode<T>::Record(root);
+      return true;
     }
   }
-defaultApproximation:
-  return ApproximationHelper::MapReduce<T>(this, approximationContext, compute<T>, computeOnComplexAndMatrix<T>, computeOnMatrixAndComplex<T>, computeOnMatrices<T>);
+  return ApproximationHelper::MapReduceScalar<T>(this, approximationContext, compute<T>, result);
 }
 
 // Power
@@ -1515,9 +1531,9 @@ bool Power::RationalExponentShouldNotBeReduced(const Rational & b, const Rationa
 }
 
 
-template Complex<float> PowerNode::compute<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
-template Complex<double> PowerNode::compute<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
-template Complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<double>(std::complex<double>, double, double);
-template Complex<float> PowerNode::computeNotPrincipalRealRootOfRationalPow<float>(std::complex<float>, float, float);
+template std::complex<float> PowerNode::compute<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
+template std::complex<double> PowerNode::compute<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
+template std::complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<double>(std::complex<double>, double, double);
+template std::complex<float> PowerNode::computeNotPrincipalRealRootOfRationalPow<float>(std::complex<float>, float, float);
 
 }
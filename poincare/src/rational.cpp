@@ -121,6 +121,13 @@ int RationalNode::NaturalOrder(const RationalNode * i, const RationalNode * j) {
   if (Number(i).sign() == Sign::Positive && Number(j).sign() == Sign::Negative) {
     return 1;
   }
+  if (i->hasNativeNumeratorAndDenominator() && j->hasNativeNumeratorAndDenominator()) {
+    // Both rationals have the same sign: compare their absolute values
+    double_native_uint_t i1 = static_cast<double_native_uint_t>(i->nativeUnsignedNumerator()) * j->nativeDenominator();
+    double_native_uint_t i2 = static_cast<double_native_uint_t>(j->nativeUnsignedNumerator()) * i->nativeDenominator();
+    int order = i1 < i2 ? -1 : (i1 > i2 ? 1 : 0);
+    return i->isNegative() ? -order : order;
+  }
   Integer i1 = Integer::Multiplication(i->signedNumerator(), j->denominator());
   Integer i2 = Integer::Multiplication(i->denominator(), j->signedNumerator());
   return Integer::NaturalOrder(i1, i2);
@@ -151,10 +158,49 @@ Expression RationalNode::denominator(ReductionContext reductionContext) const {
 
 /* Rational  */
 
+// Native arithmetic
+
+static double_native_uint_t NativeGCD(double_native_uint_t a, double_native_uint_t b) {
+  // Binary GCD, which only shifts and subtracts
+  if (a == 0 || b == 0) {
+    return a | b;
+  }
+  int shift = __builtin_ctzll(a | b);
+  a >>= __builtin_ctzll(a);
+  do {
+    b >>= __builtin_ctzll(b);
+    if (a > b) {
+      std::swap(a, b);
+    }
+    b -= a;
+  } while (b != 0);
+  return a << shift;
+}
+
+static bool FitsInNativeDigits(const Integer & i) {
+  static_assert(sizeof(double_native_uint_t) == 2 * sizeof(native_uint_t), "An Integer of two digits does not fit in double_native_uint_t");
+  return i.numberOfDigits() <= 2;
+}
+
+static double_native_uint_t NativeUnsignedValue(const Integer & i) {
+  assert(FitsInNativeDigits(i));
+  double_native_uint_t result = 0;
+  for (int d = i.numberOfDigits() - 1; d >= 0; d--) {
+    result = (result << (8 * sizeof(native_uint_t))) | i.digits()[d];
+  }
+  return result;
+}
+
 // Constructors
 
 Rational Rational::Builder(Integer & num, Integer & den) {
   assert(!den.isZero());
+  if (FitsInNativeDigits(num) && FitsInNativeDigits(den)) {
+    double_native_uint_t n = NativeUnsignedValue(num);
+    double_native_uint_t d = NativeUnsignedValue(den);
+    double_native_uint_t gcd = NativeGCD(n, d);
+    return Rational::Builder(n / gcd, d / gcd, num.isNegative() != den.isNegative());
+  }
   if (!num.isOne() && !den.isOne()) {
     // Avoid computing GCD if possible
     Integer gcd = Arithmetic::GCD(num, den);
@@ -180,9 +226,12 @@ Rational Rational::Builder(native_int_t i) {
 }
 
 Rational Rational::Builder(native_int_t i, native_int_t j) {
-  Integer iInteger(i);
-  Integer jInteger(j);
-  return Rational::Builder(iInteger, jInteger);
+  assert(j != 0);
+  // Negating in native_uint_t is well defined, even for the smallest native_int_t
+  native_uint_t absI = i < 0 ? -static_cast<native_uint_t>(i) : i;
+  native_uint_t absJ = j < 0 ? -static_cast<native_uint_t>(j) : j;
+  double_native_uint_t gcd = NativeGCD(absI, absJ);
+  return Rational::Builder(absI / gcd, absJ / gcd, (i < 0) != (j < 0));
 }
 
 Rational Rational::Builder(const char * iString, const char * jString) {
@@ -198,12 +247,53 @@ bool Rational::numeratorOrDenominatorIsInfinity() const {
 // Basic operations
 
 Rational Rational::Addition(const Rational & i, const Rational & j) {
+  if (i.node()->hasNativeNumeratorAndDenominator() && j.node()->hasNativeNumeratorAndDenominator()) {
+    /* With b = g*b' and d = g*d', a/b + c/d = (a*d' + c*b') / (g*b'*d'). As
+     * a/b and c/d are irreducible, the numerator is prime with b' and d', so
+     * the result is reduced by the gcd of the numerator and g only. */
+    double_native_uint_t a = i.node()->nativeUnsignedNumerator(), b = i.node()->nativeDenominator();
+    double_native_uint_t c = j.node()->nativeUnsignedNumerator(), d = j.node()->nativeDenominator();
+    double_native_uint_t g = NativeGCD(b, d);
+    double_native_uint_t p = a * (d / g), q = c * (b / g);
+    double_native_uint_t numerator;
+    bool negative;
+    bool overflow = false;
+    if (i.isNegative() == j.isNegative()) {
+      numerator = p + q;
+      overflow = numerator < p;
+      negative = i.isNegative();
+    } else if (p >= q) {
+      numerator = p - q;
+      negative = i.isNegative();
+    } else {
+      numerator = q - p;
+      negative = j.isNegative();
+    }
+    if (!overflow) {
+      if (numerator == 0) {
+        return Rational::Builder(0);
+      }
+      double_native_uint_t h = NativeGCD(numerator, g);
+      return Rational::Builder(numerator / h, (b / g) * (d / h), negative);
+    }
+    // Otherwise, the numerator needs more than two digits
+  }
   Integer newNumerator = Integer::Addition(Integer::Multiplication(i.signedIntegerNumerator(), j.integerDenominator()), Integer::Multiplication(j.signedIntegerNumerator(), i.integerDenominator()));
   Integer newDenominator = Integer::Multiplication(i.integerDenominator(), j.integerDenominator());
   return Rational::Builder(newNumerator, newDenominator);
 }
 
 Rational Rational::Multiplication(const Rational & i, const Rational & j) {
+  if (i.node()->hasNativeNumeratorAndDenominator() && j.node()->hasNativeNumeratorAndDenominator()) {
+    /* Cross-cancel a/b * c/d: as both fractions are irreducible, so is the
+     * product once a and d, and c and b, have been divided by their gcd. */
+    native_uint_t a = i.node()->nativeUnsignedNumerator(), b = i.node()->nativeDenominator();
+    native_uint_t c = j.node()->nativeUnsignedNumerator(), d = j.node()->nativeDenominator();
+    native_uint_t ad = NativeGCD(a, d), cb = NativeGCD(c, b);
+    double_native_uint_t numerator = static_cast<double_native_uint_t>(a / ad) * (c / cb);
+    double_native_uint_t denominator = static_cast<double_native_uint_t>(b / cb) * (d / ad);
+    return Rational::Builder(numerator, denominator, i.isNegative() != j.isNegative());
+  }
   Integer newNumerator = Integer::Multiplication(i.signedIntegerNumerator(), j.signedIntegerNumerator());
   Integer newDenominator = Integer::Multiplication(i.integerDenominator(), j.integerDenominator());
   return Rational::Builder(newNumerator, newDenominator);
@@ -227,6 +317,17 @@ Rational Rational::Builder(const native_uint_t * i, uint8_t numeratorSize, const
   return static_cast<Rational &>(h);
 }
 
+Rational Rational::Builder(double_native_uint_t numerator, double_native_uint_t denominator, bool negative) {
+  assert(denominator != 0 && NativeGCD(numerator, denominator) == 1);
+  constexpr int k_digitBits = 8 * sizeof(native_uint_t);
+  native_uint_t numeratorDigits[2] = {static_cast<native_uint_t>(numerator), static_cast<native_uint_t>(numerator >> k_digitBits)};
+  native_uint_t denominatorDigits[2] = {static_cast<native_uint_t>(denominator), static_cast<native_uint_t>(denominator >> k_digitBits)};
+  uint8_t numeratorSize = numeratorDigits[1] != 0 ? 2 : numeratorDigits[0] != 0 ? 1 : 0;
+  uint8_t denominatorSize = denominatorDigits[1] != 0 ? 2 : 1;
+  // Zero is always positive
+  return Rational::Builder(numeratorDigits, numeratorSize, denominatorDigits, denominatorSize, negative && numeratorSize > 0);
+}
+
 Expression Rational::shallowReduce() {
   // FIXME:
   /* Infinite Rational should not exist as they aren't parsed and are supposed
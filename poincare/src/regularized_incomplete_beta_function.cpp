@@ -26,6 +26,7 @@
 // WARNING: this code has been modified
 
 #include <poincare/regularized_incomplete_beta_function.h>
+#include <poincare/beta_function.h>
 #include <math.h>
 #include <cmath>
 
@@ -36,14 +37,18 @@ namespace Poincare {
 
 double RegularizedIncompleteBetaFunction(double a, double b, double x) {
     if (x < 0.0 || x > 1.0) return NAN;
+    return RegularizedIncompleteBetaFunction(a, b, x, LnBetaFunction(a, b));
+}
+
+double RegularizedIncompleteBetaFunction(double a, double b, double x, double lbeta_ab) {
+    if (x < 0.0 || x > 1.0) return NAN;
 
     /*The continued fraction converges nicely for x < (a+1)/(a+b+2)*/
     if (x > (a+1.0)/(a+b+2.0)) {
-        return (1.0-RegularizedIncompleteBetaFunction(b,a,1.0-x)); /*Use the fact that beta is symmetrical.*/
+        return (1.0-RegularizedIncompleteBetaFunction(b,a,1.0-x,lbeta_ab)); /*Use the fact that beta is symmetrical.*/
     }
 
     /*Find the first part before the continued fraction.*/
-    const double lbeta_ab = std::lgamma(a)+std::lgamma(b)-std::lgamma(a+b);
     const double front = std::exp(std::log(x)*a+std::log(1.0-x)*b-lbeta_ab) / a;
 
     /*Use Lentz's algorithm to evaluate the continued fraction.*/
@@ -175,6 +175,214 @@ double Solver::BrentRoot(double ax, double bx, double precision, ValueAtAbscissa
   return NAN;
 }
 
+class Solver::RootsSearch {
+public:
+  RootsSearch(double step, double * roots, int maxNumberOfRoots, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) :
+    m_step(step),
+    m_roots(roots),
+    m_maxNumberOfRoots(maxNumberOfRoots),
+    m_numberOfRoots(0),
+    m_subdivisionBudget(0),
+    m_evaluation(evaluation),
+    m_context(context),
+    m_complexFormat(complexFormat),
+    m_angleUnit(angleUnit),
+    m_context1(context1),
+    m_context2(context2),
+    m_context3(context3)
+  {}
+  int numberOfRoots() const { return m_numberOfRoots; }
+  /* Each sampled interval earns one subdivision, and the budget is capped by
+   * the full subdivision of a single interval. Subdivisions thus at most
+   * double the number of evaluations of the sampling, while being spent
+   * where they are needed. */
+  void increaseSubdivisionBudget() {
+    constexpr int k_maxSubdivisionBudget = (1 << k_maxNumberOfSubdivisions) - 1;
+    m_subdivisionBudget = m_subdivisionBudget < k_maxSubdivisionBudget ? m_subdivisionBudget + 1 : k_maxSubdivisionBudget;
+  }
+  /* Roots located after the last root found cannot replace it once the buffer
+   * is full. */
+  bool isComplete(double minimalAbscissaOfNextRoots) const {
+    return m_numberOfRoots == m_maxNumberOfRoots && m_roots[m_numberOfRoots - 1] < minimalAbscissaOfNextRoots;
+  }
+  double evaluate(double x) const {
+    return m_evaluation(x, m_context, m_complexFormat, m_angleUnit, m_context1, m_context2, m_context3);
+  }
+  void lookForRootsInInterval(Coordinate2D<double> a, Coordinate2D<double> b, int depth);
+  void lookForRootAtZeroSample(Coordinate2D<double> a, Coordinate2D<double> b, Coordinate2D<double> c);
+  void lookForRootAtExtremum(Coordinate2D<double> a, Coordinate2D<double> b, Coordinate2D<double> c, double sign);
+private:
+  static bool HaveOppositeSigns(double fa, double fb) { return (fa < 0.0 && fb > 0.0) || (fa > 0.0 && fb < 0.0); }
+  double zeroPrecision() const { return m_step * k_relativeZeroPrecision; }
+  /* Roots refined with BrentRoot are precise, whereas roots found at extrema
+   * are only located up to the flatness of the function. */
+  void addRoot(double x, bool isPrecise = true);
+  double m_step;
+  double * m_roots;
+  int m_maxNumberOfRoots;
+  int m_numberOfRoots;
+  int m_subdivisionBudget;
+  ValueAtAbscissa m_evaluation;
+  Context * m_context;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+  const void * m_context1;
+  const void * m_context2;
+  const void * m_context3;
+};
+
+void Solver::RootsSearch::lookForRootsInInterval(Coordinate2D<double> a, Coordinate2D<double> b, int depth) {
+  double fa = a.x2();
+  double fb = b.x2();
+  if (HaveOppositeSigns(fa, fb)) {
+    addRoot(BrentRoot(a.x1(), b.x1(), m_step * k_relativeRootPrecision, m_evaluation, m_context, m_complexFormat, m_angleUnit, m_context1, m_context2, m_context3));
+    return;
+  }
+  /* The function keeps the same sign at both ends, but it may still cross 0
+   * twice in between if it moves more than its distance to 0. Such intervals
+   * are split, within the subdivision budget. */
+  if (depth >= k_maxNumberOfSubdivisions || m_subdivisionBudget <= 0
+      || fa == 0.0 || fb == 0.0 || !std::isfinite(fa) || !std::isfinite(fb)
+      || std::fabs(fb - fa) <= std::fmin(std::fabs(fa), std::fabs(fb))) {
+    return;
+  }
+  m_subdivisionBudget--;
+  double xm = 0.5 * (a.x1() + b.x1());
+  Coordinate2D<double> m(xm, evaluate(xm));
+  lookForRootsInInterval(a, m, depth + 1);
+  lookForRootsInInterval(m, b, depth + 1);
+  lookForRootAtExtremum(a, m, b, 1.0);
+  lookForRootAtExtremum(a, m, b, -1.0);
+}
+
+void Solver::RootsSearch::lookForRootAtZeroSample(Coordinate2D<double> a, Coordinate2D<double> b, Coordinate2D<double> c) {
+  /* If fb is null, we still check that the function changes sign on ]a,c[,
+   * and that fa and fc are not null. Otherwise, it's more likely those zeroes
+   * are caused by approximation errors. */
+  if (b.x2() == 0.0 && HaveOppositeSigns(a.x2(), c.x2())) {
+    addRoot(b.x1());
+  }
+}
+
+void Solver::RootsSearch::lookForRootAtExtremum(Coordinate2D<double> a, Coordinate2D<double> b, Coordinate2D<double> c, double sign) {
+  /* Look for a minimum of sign*f bracketed by a, b and c, as in
+   * Expression::bracketMinimum. */
+  double ga = sign * a.x2();
+  double gb = sign * b.x2();
+  double gc = sign * c.x2();
+  if (!((ga > gb || std::isnan(ga)) && (gc > gb || std::isnan(gc)) && (!std::isnan(ga) || !std::isnan(gc)))) {
+    return;
+  }
+  /* If the sampled extremum is already on the other side of 0, the function
+   * crosses 0 on both sides and these roots are found by sign changes. */
+  if (gb < -zeroPrecision()) {
+    return;
+  }
+  Coordinate2D<double> extremum = BrentMinimum(a.x1(), c.x1(),
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const RootsSearch * search = static_cast<const RootsSearch *>(context1);
+        const double * sign = static_cast<const double *>(context2);
+        return *sign * search->evaluate(x);
+      }, m_context, m_complexFormat, m_angleUnit, this, &sign);
+  double x = extremum.x1();
+  double g = extremum.x2();
+  if (std::isnan(g)) {
+    return;
+  }
+  // Because of float approximation, exact zero is never reached
+  if (std::fabs(x) < zeroPrecision()) {
+    x = 0.0;
+    g = sign * evaluate(x);
+  }
+  if (std::fabs(g) < zeroPrecision()) {
+    addRoot(x, false);
+  } else if (g < 0.0) {
+    /* The function dips across 0 between two samples: both crossings are
+     * bracketed by the extremum. */
+    Coordinate2D<double> e(x, sign * g);
+    if (HaveOppositeSigns(a.x2(), e.x2())) {
+      addRoot(BrentRoot(a.x1(), x, m_step * k_relativeRootPrecision, m_evaluation, m_context, m_complexFormat, m_angleUnit, m_context1, m_context2, m_context3));
+    }
+    if (HaveOppositeSigns(e.x2(), c.x2())) {
+      addRoot(BrentRoot(x, c.x1(), m_step * k_relativeRootPrecision, m_evaluation, m_context, m_complexFormat, m_angleUnit, m_context1, m_context2, m_context3));
+    }
+  }
+}
+
+void Solver::RootsSearch::addRoot(double x, bool isPrecise) {
+  if (std::isnan(x)) {
+    return;
+  }
+  if (std::fabs(x) < zeroPrecision()) {
+    x = 0.0;
+  }
+  /* The same extremum may be bracketed both by the sampling and by a
+   * subdivision: imprecise roots closer than the finest subdivision step are
+   * merged. */
+  double duplicatePrecision = isPrecise ? zeroPrecision() : 0.5 * m_step / (1 << k_maxNumberOfSubdivisions);
+  int i = m_numberOfRoots;
+  while (i > 0 && m_roots[i - 1] > x) {
+    i--;
+  }
+  if ((i > 0 && x - m_roots[i - 1] < duplicatePrecision) || (i < m_numberOfRoots && m_roots[i] - x < duplicatePrecision)) {
+    return;
+  }
+  if (i == m_maxNumberOfRoots) {
+    return;
+  }
+  int numberOfShiftedRoots = (m_numberOfRoots == m_maxNumberOfRoots ? m_numberOfRoots - 1 : m_numberOfRoots) - i;
+  for (int j = i + numberOfShiftedRoots; j > i; j--) {
+    m_roots[j] = m_roots[j - 1];
+  }
+  m_roots[i] = x;
+  if (m_numberOfRoots < m_maxNumberOfRoots) {
+    m_numberOfRoots++;
+  }
+}
+
+int Solver::Roots(double start, double end, double step, double * roots, int maxNumberOfRoots, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+  assert(start < end && step > 0.0 && maxNumberOfRoots > 0);
+  RootsSearch search(step, roots, maxNumberOfRoots, evaluation, context, complexFormat, angleUnit, context1, context2, context3);
+  /* samples holds the two previous samples. minimumBracket and
+   * maximumBracket hold the two first points of the brackets of extrema: as
+   * in Expression::bracketMinimum, they do not move along a plateau following
+   * a decrease (or an increase). */
+  Coordinate2D<double> samples[2];
+  Coordinate2D<double> minimumBracket[2];
+  Coordinate2D<double> maximumBracket[2];
+  bool reachedEnd = false;
+  for (int i = 0; !reachedEnd; i++) {
+    double x = start + i * step;
+    if (x >= end) {
+      x = end;
+      reachedEnd = true;
+    }
+    Coordinate2D<double> current(x, search.evaluate(x));
+    if (i >= 1) {
+      search.increaseSubdivisionBudget();
+      search.lookForRootsInInterval(samples[1], current, 0);
+    }
+    if (i >= 2) {
+      search.lookForRootAtZeroSample(samples[0], samples[1], current);
+      search.lookForRootAtExtremum(minimumBracket[0], minimumBracket[1], current, 1.0);
+      search.lookForRootAtExtremum(maximumBracket[0], maximumBracket[1], current, -1.0);
+    }
+    samples[0] = samples[1];
+    samples[1] = current;
+    if (i < 2 || !(minimumBracket[0].x2() > minimumBracket[1].x2() && minimumBracket[1].x2() == current.x2())) {
+      minimumBracket[0] = minimumBracket[1];
+      minimumBracket[1] = current;
+    }
+    if (i < 2 || !(maximumBracket[0].x2() < maximumBracket[1].x2() && maximumBracket[1].x2() == current.x2())) {
+      maximumBracket[0] = maximumBracket[1];
+      maximumBracket[1] = current;
+    }
+    if (i >= 1 && search.isComplete(std::fmin(samples[0].x1(), std::fmin(minimumBracket[0].x1(), maximumBracket[0].x1())))) {
+      break;
+    }
+  }
+  return search.numberOfRoots();
+}
 
 Coordinate2D<double> Solver::IncreasingFunctionRoot(double ax, double bx, double resultPrecision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3, double * resultEvaluation) {
   assert(ax < bx);
@@ -100,6 +100,17 @@ Evaluation<T> SymbolNode::templatedApproximate(ApproximationContext approximatio
   return e.node()->approximate(T(), approximationContext);
 }
 
+template<typename T>
+bool SymbolNode::templatedApproximateScalar(ApproximationContext approximationContext, std::complex<T> * result) const {
+  Symbol s(this);
+  Expression e = SymbolAbstract::Expand(s, approximationContext.context(), false);
+  if (e.isUninitialized()) {
+    *result = std::complex<T>(NAN, NAN);
+    return true;
+  }
+  return e.node()->approximateScalar(T(), approximationContext, result);
+}
+
 bool SymbolNode::isUnknown() const {
   bool result = UTF8Helper::CodePointIs(m_name, UCodePointUnknown);
   if (result) {
@@ -12,6 +12,7 @@
 #include <utility>
 #include <apps/i18n.h>
 #include <apps/global_preferences.h>
+#include "parsing/identifier_table.h"
 
 
 namespace Poincare {
@@ -297,44 +298,6 @@ int UnitNode::Representative::serialize(char * buffer, int bufferSize, const Pre
   return length;
 }
 
-bool UnitNode::Representative::canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const {
-  const Representative * candidate = representativesOfSameDimension();
-  if (!candidate) {
-    return false;
-  }
-  for (int i = 0; i < numberOfRepresentatives(); i++) {
-    const char * rootSymbol = (candidate + i)->rootSymbol();
-    size_t rootSymbolLength = strlen(rootSymbol);
-    int potentialPrefixLength = length - rootSymbolLength;
-    if (potentialPrefixLength >= 0
-     && strncmp(rootSymbol, symbol + potentialPrefixLength, rootSymbolLength) == 0
-     && candidate[i].canParse(symbol, potentialPrefixLength, prefix)) {
-      *representative = (candidate + i);
-      return true;
-    }
-  }
-  return false;
-}
-
-bool UnitNode::Representative::canParse(const char * symbol, size_t length, const Prefix * * prefix) const {
-  if (!isInputPrefixable()) {
-    *prefix = Prefix::EmptyPrefix();
-    return length == 0;
-  }
-  for (size_t i = 0; i < Prefix::k_numberOfPrefixes; i++) {
-    const Prefix * pre = Prefix::Prefixes() + i;
-    const char * prefixSymbol = pre->symbol();
-    if (strlen(prefixSymbol) == length
-     && canPrefix(pre, true)
-     && strncmp(symbol, prefixSymbol, length) == 0)
-    {
-      *prefix = pre;
-      return true;
-    }
-  }
-  return false;
-}
-
 Expression UnitNode::Representative::toBaseUnits() const {
   Expression result;
   if (isBaseUnit()) {
@@ -721,9 +684,130 @@ Unit Unit::Builder(const Unit::Representative * representative, const Prefix * p
   return static_cast<Unit &>(h);
 }
 
+/* Unit symbols are parsed by looking up their prefix and their root symbol in
+ * the tables below, sorted according to symbol. */
+static constexpr const UnitNode::Representative * k_representativesSortedBySymbol[] = {
+  &Unit::k_currentRepresentatives[0], // A
+  &Unit::k_electricChargeRepresentatives[0], // C
+  &Unit::k_massRepresentatives[2], // Da
+  &Unit::k_electricCapacitanceRepresentatives[0], // F
+  &Unit::k_inductanceRepresentatives[0], // H
+  &Unit::k_frequencyRepresentatives[0], // Hz
+  &Unit::k_energyRepresentatives[0], // J
+  &Unit::k_temperatureRepresentatives[0], // K
+  &Unit::k_volumeRepresentatives[0], // L
+  &Unit::k_forceRepresentatives[0], // N
+  &Unit::k_pressureRepresentatives[0], // Pa
+  &Unit::k_electricConductanceRepresentatives[0], // S
+  &Unit::k_magneticFieldRepresentatives[0], // T
+  &Unit::k_electricPotentialRepresentatives[0], // V
+  &Unit::k_powerRepresentatives[0], // W
+  &Unit::k_magneticFluxRepresentatives[0], // Wb
+  &Unit::k_surfaceRepresentatives[1], // acre
+  &Unit::k_pressureRepresentatives[2], // atm
+  &Unit::k_distanceRepresentatives[1], // au
+  &Unit::k_pressureRepresentatives[1], // bar
+  &Unit::k_luminousIntensityRepresentatives[0], // cd
+  &Unit::k_volumeRepresentatives[4], // cup
+  &Unit::k_timeRepresentatives[3], // day
+  &Unit::k_energyRepresentatives[1], // eV
+  &Unit::k_volumeRepresentatives[3], // floz
+  &Unit::k_distanceRepresentatives[5], // ft
+  &Unit::k_massRepresentatives[0], // g
+  &Unit::k_volumeRepresentatives[7], // gal
+  &Unit::k_timeRepresentatives[2], // h
+  &Unit::k_surfaceRepresentatives[0], // ha
+  &Unit::k_distanceRepresentatives[4], // in
+  &Unit::k_catalyticActivityRepresentatives[0], // kat
+  &Unit::k_massRepresentatives[4], // lb
+  &Unit::k_massRepresentatives[6], // lgtn
+  &Unit::k_distanceRepresentatives[2], // ly
+  &Unit::k_distanceRepresentatives[0], // m
+  &Unit::k_distanceRepresentatives[7], // mi
+  &Unit::k_timeRepresentatives[1], // min
+  &Unit::k_amountOfSubstanceRepresentatives[0], // mol
+  &Unit::k_timeRepresentatives[5], // month
+  &Unit::k_massRepresentatives[3], // oz
+  &Unit::k_distanceRepresentatives[3], // pc
+  &Unit::k_volumeRepresentatives[5], // pt
+  &Unit::k_volumeRepresentatives[6], // qt
+  &Unit::k_timeRepresentatives[0], // s
+  &Unit::k_massRepresentatives[5], // shtn
+  &Unit::k_massRepresentatives[1], // t
+  &Unit::k_volumeRepresentatives[2], // tbsp
+  &Unit::k_volumeRepresentatives[1], // tsp
+  &Unit::k_timeRepresentatives[4], // week
+  &Unit::k_distanceRepresentatives[6], // yd
+  &Unit::k_timeRepresentatives[6], // year
+  &Unit::k_temperatureRepresentatives[1], // °C
+  &Unit::k_temperatureRepresentatives[2], // °F
+  &Unit::k_electricResistanceRepresentatives[0], // Ω
+};
+static constexpr int k_numberOfRepresentatives = sizeof(k_representativesSortedBySymbol)/sizeof(UnitNode::Representative *);
+
+template<typename T, size_t N>
+static constexpr int NumberOfElements(const T (&)[N]) { return N; }
+static_assert(k_numberOfRepresentatives ==
+  NumberOfElements(Unit::k_timeRepresentatives) +
+  NumberOfElements(Unit::k_distanceRepresentatives) +
+  NumberOfElements(Unit::k_massRepresentatives) +
+  NumberOfElements(Unit::k_currentRepresentatives) +
+  NumberOfElements(Unit::k_temperatureRepresentatives) +
+  NumberOfElements(Unit::k_amountOfSubstanceRepresentatives) +
+  NumberOfElements(Unit::k_luminousIntensityRepresentatives) +
+  NumberOfElements(Unit::k_frequencyRepresentatives) +
+  NumberOfElements(Unit::k_forceRepresentatives) +
+  NumberOfElements(Unit::k_pressureRepresentatives) +
+  NumberOfElements(Unit::k_energyRepresentatives) +
+  NumberOfElements(Unit::k_powerRepresentatives) +
+  NumberOfElements(Unit::k_electricChargeRepresentatives) +
+  NumberOfElements(Unit::k_electricPotentialRepresentatives) +
+  NumberOfElements(Unit::k_electricCapacitanceRepresentatives) +
+  NumberOfElements(Unit::k_electricResistanceRepresentatives) +
+  NumberOfElements(Unit::k_electricConductanceRepresentatives) +
+  NumberOfElements(Unit::k_magneticFluxRepresentatives) +
+  NumberOfElements(Unit::k_magneticFieldRepresentatives) +
+  NumberOfElements(Unit::k_inductanceRepresentatives) +
+  NumberOfElements(Unit::k_catalyticActivityRepresentatives) +
+  NumberOfElements(Unit::k_surfaceRepresentatives) +
+  NumberOfElements(Unit::k_volumeRepresentatives),
+  "Some representatives are missing from k_representativesSortedBySymbol");
+
+static constexpr const UnitNode::Prefix * k_prefixesSortedBySymbol[] = {
+  &Unit::k_prefixes[6], // empty prefix
+  &Unit::k_prefixes[11], // G
+  &Unit::k_prefixes[10], // M
+  &Unit::k_prefixes[12], // T
+  &Unit::k_prefixes[4], // c
+  &Unit::k_prefixes[5], // d
+  &Unit::k_prefixes[7], // da
+  &Unit::k_prefixes[8], // h
+  &Unit::k_prefixes[9], // k
+  &Unit::k_prefixes[3], // m
+  &Unit::k_prefixes[1], // n
+  &Unit::k_prefixes[0], // p
+  &Unit::k_prefixes[2], // μ
+};
+static_assert(sizeof(k_prefixesSortedBySymbol)/sizeof(UnitNode::Prefix *) == UnitNode::Prefix::k_numberOfPrefixes, "Some prefixes are missing from k_prefixesSortedBySymbol");
+
+static constexpr const char * RepresentativeSymbol(const UnitNode::Representative * representative) { return representative->rootSymbol(); }
+static constexpr const char * PrefixSymbol(const UnitNode::Prefix * prefix) { return prefix->symbol(); }
+
+static_assert(IdentifierTable::IsSorted(k_representativesSortedBySymbol, k_numberOfRepresentatives, &RepresentativeSymbol, true), "k_representativesSortedBySymbol must be strictly ordered according to symbol");
+static_assert(IdentifierTable::IsSorted(k_prefixesSortedBySymbol, UnitNode::Prefix::k_numberOfPrefixes, &PrefixSymbol, true), "k_prefixesSortedBySymbol must be strictly ordered according to symbol");
+
 bool Unit::CanParse(const char * symbol, size_t length, const Unit::Representative * * representative, const Unit::Prefix * * prefix) {
-  for (int i = 0; i < Representative::k_numberOfDimensions; i++) {
-    if (Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(symbol, length, representative, prefix)) {
+  /* No unit symbol can be split in two different ways into a prefix and a
+   * root symbol, so every split is tried. */
+  for (size_t prefixLength = 0; prefixLength < length; prefixLength++) {
+    const Representative * const * representativeCandidate = IdentifierTable::Find(k_representativesSortedBySymbol, k_numberOfRepresentatives, symbol + prefixLength, length - prefixLength, &RepresentativeSymbol);
+    if (representativeCandidate == nullptr) {
+      continue;
+    }
+    const Prefix * const * prefixCandidate = IdentifierTable::Find(k_prefixesSortedBySymbol, Prefix::k_numberOfPrefixes, symbol, prefixLength, &PrefixSymbol);
+    if (prefixCandidate != nullptr && (*representativeCandidate)->canPrefix(*prefixCandidate, true)) {
+      *representative = *representativeCandidate;
+      *prefix = *prefixCandidate;
       return true;
     }
   }
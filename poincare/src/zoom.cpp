@@ -8,7 +8,8 @@ namespace Poincare {
 
 constexpr int
   Zoom::k_peakNumberOfPointsOfInterest,
-  Zoom::k_sampleSize;
+  Zoom::k_sampleSize,
+  Zoom::Samples::k_maxNumberOfSamplesPerSide;
 constexpr float
   Zoom::k_maximalDistance,
   Zoom::k_minimalDistance,
@@ -34,7 +35,82 @@ static bool DoesNotOverestimatePrecision(float dx, float y1, float y2, float y3)
   return (yMax - yMin) / std::fabs(dx) > maxPrecision;
 }
 
-bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, float tMin, float tMax, Context * context, const void * auxiliary) {
+bool Zoom::Samples::areDenseOn(float xMin, float xMax, int numberOfSamples) const {
+  if (m_numberOfSamples == 0) {
+    return false;
+  }
+  float lastDistance = m_distances[m_numberOfSamples - 1];
+  if (!(xMin >= m_center - lastDistance && xMax <= m_center + lastDistance)) {
+    return false;
+  }
+  int count = 0;
+  for (int i = 0; i < m_numberOfSamples; i++) {
+    count += (m_center - m_distances[i] >= xMin) + (m_center + m_distances[i] <= xMax);
+  }
+  return count >= numberOfSamples;
+}
+
+float Zoom::Samples::valueAt(float x) const {
+  assert(m_numberOfSamples > 0);
+  int side = x < m_center ? 0 : 1;
+  float distance = std::fabs(x - m_center);
+  int n = indexBefore(distance);
+  float d1, d2, y1, y2;
+  if (n < 0) {
+    // x lies between the first samples on each side of the center
+    d1 = - m_distances[0];
+    y1 = m_values[1 - side][0];
+  } else if (n == m_numberOfSamples - 1) {
+    return distance == m_distances[n] ? m_values[side][n] : NAN;
+  } else {
+    d1 = m_distances[n];
+    y1 = m_values[side][n];
+  }
+  d2 = m_distances[n + 1];
+  y2 = m_values[side][n + 1];
+  float t = (distance - d1) / (d2 - d1);
+  /* Interpolating linearly between samples of different orders of magnitude
+   * would overestimate the function: they are interpolated geometrically if
+   * they have the same sign, or else the nearest one is used. */
+  if (std::fabs(y2 - y1) > k_explosionThreshold * std::min(std::fabs(y1), std::fabs(y2))) {
+    if (y1 * y2 > 0.f) {
+      return y1 * std::pow(y2 / y1, t);
+    }
+    return t < 0.5f ? y1 : y2;
+  }
+  return y1 + (y2 - y1) * t;
+}
+
+void Zoom::Samples::addSample(int side, float distance, float value) {
+  /* The grid is explored leftward first, which sets its distances, and then
+   * rightward on the same distances. */
+  int n;
+  if (side == 0) {
+    assert(m_numberOfSamples < k_maxNumberOfSamplesPerSide);
+    n = m_numberOfSamples++;
+    m_distances[n] = distance;
+  } else {
+    n = indexBefore(distance);
+    assert(n >= 0 && m_distances[n] == distance);
+  }
+  m_values[side][n] = value;
+}
+
+int Zoom::Samples::indexBefore(float distance) const {
+  // Return the last n such that m_distances[n] <= distance, or -1
+  int lower = -1, upper = m_numberOfSamples;
+  while (upper - lower > 1) {
+    int middle = (lower + upper) / 2;
+    if (m_distances[middle] <= distance) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, float tMin, float tMax, Context * context, const void * auxiliary, float precision, Samples * samples) {
   assert(xMin && xMax && yMin && yMax);
 
   const bool hasIntervalOfDefinition = std::isfinite(tMin) && std::isfinite(tMax);
@@ -46,6 +122,10 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
     center = 0.f;
     maxDistance = k_maximalDistance;
   }
+  if (samples) {
+    samples->m_center = center;
+    samples->m_numberOfSamples = 0;
+  }
 
   float resultX[2] = {FLT_MAX, - FLT_MAX};
   float resultYMin = FLT_MAX, resultYMax = - FLT_MAX;
@@ -58,7 +138,7 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
 
   /* Look for a point of interest at the center. */
   const float a = center - k_minimalDistance - FLT_EPSILON, b = center + FLT_EPSILON, c = center + k_minimalDistance + FLT_EPSILON;
-  const float ya = evaluation(a, context, auxiliary), yb = evaluation(b, context, auxiliary), yc = evaluation(c, context, auxiliary);
+  const float ya = Round(evaluation(a, context, auxiliary), precision), yb = Round(evaluation(b, context, auxiliary), precision), yc = Round(evaluation(c, context, auxiliary), precision);
   if (BoundOfIntervalOfDefinitionIsReached(ya, yc) ||
       BoundOfIntervalOfDefinitionIsReached(yc, ya) ||
       RootExistsOnInterval(ya, yc) ||
@@ -66,7 +146,7 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
   {
     resultX[0] = resultX[1] = center;
     totalNumberOfPoints++;
-    if (ExtremumExistsOnInterval(ya, yb, yc) && IsConvexAroundExtremum(evaluation, a, b, c, ya, yb, yc, context, auxiliary)) {
+    if (ExtremumExistsOnInterval(ya, yb, yc) && IsConvexAroundExtremum(evaluation, a, b, c, ya, yb, yc, context, auxiliary, precision)) {
       resultYMin = resultYMax = yb;
     }
   }
@@ -82,6 +162,12 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
     dXNext = dXPrev * k_stepFactor;
     yPrev = evaluation(center + dXPrev, context, auxiliary);
     yNext = evaluation(center + dXNext, context, auxiliary);
+    if (samples) {
+      samples->addSample(i, std::fabs(dXPrev), yPrev);
+      samples->addSample(i, std::fabs(dXNext), yNext);
+    }
+    yPrev = Round(yPrev, precision);
+    yNext = Round(yNext, precision);
 
     while(std::fabs(dXPrev) < maxDistance) {
       /* Update the slider. */
@@ -91,6 +177,10 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
       yOld = yPrev;
       yPrev = yNext;
       yNext = evaluation(center + dXNext, context, auxiliary);
+      if (samples) {
+        samples->addSample(i, std::fabs(dXNext), yNext);
+      }
+      yNext = Round(yNext, precision);
       if (std::isinf(yNext)) {
         continue;
       }
@@ -104,7 +194,7 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
          * range when an extremum is detected, but need to update the X range
          * in all cases. */
       case static_cast<uint8_t>(PointOfInterest::Extremum):
-        if (IsConvexAroundExtremum(evaluation, center + dXOld, center + dXPrev, center + dXNext, yOld, yPrev, yNext, context, auxiliary)) {
+        if (IsConvexAroundExtremum(evaluation, center + dXOld, center + dXPrev, center + dXNext, yOld, yPrev, yNext, context, auxiliary, precision)) {
           resultYMin = std::min(resultYMin, yPrev);
           resultYMax = std::max(resultYMax, yPrev);
         }
@@ -195,11 +285,12 @@ bool Zoom::InterestingRangesForDisplay(ValueAtAbscissa evaluation, float * xMin,
   return true;
 }
 
-void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary) {
+void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, const Samples * samples) {
   /* This methods computes the Y range that will be displayed for cartesian
    * functions and sequences, given an X range (xMin, xMax) and bounds yMin and
    * yMax that must be inside the Y range.*/
   assert(yMin && yMax);
+  UseSamplesIfDenseOn(samples, *xMin, *xMax, k_sampleSize, &evaluation, &auxiliary);
 
   float sample[k_sampleSize];
   float sampleYMin = FLT_MAX, sampleYMax = -FLT_MAX;
@@ -252,7 +343,7 @@ void Zoom::RefinedYRangeForDisplay(ValueAtAbscissa evaluation, float * xMin, flo
   ExpandSparseWindow(sample, k_sampleSize, xMin, xMax, yMin, yMax);
 }
 
-void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary) {
+void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary, const Samples * samples) {
   /* The goal of this algorithm is to find the window with given ratio, that
    * best suits the function.
    * - The X range is centered around a point of interest of the function, or
@@ -267,6 +358,7 @@ void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, f
   *xMin = xCenter - k_defaultHalfRange;
   *xMax = xCenter + k_defaultHalfRange;
   float xRange = 2 * k_defaultHalfRange;
+  UseSamplesIfDenseOn(samples, *xMin, *xMax, sampleSize, &evaluation, &auxiliary);
   float step = xRange / (sampleSize - 1);
   float sample[sampleSize];
   for (int i = 0; i < sampleSize; i++) {
@@ -435,7 +527,7 @@ void Zoom::SetZoom(float ratio, float xCenter, float yCenter, float * xMin, floa
   *yMax = oneMinusRatio * yCenter + ratio * *yMax;
 }
 
-bool Zoom::IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2, float x3, float y1, float y2, float y3, Context * context, const void * auxiliary, int iterations) {
+bool Zoom::IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2, float x3, float y1, float y2, float y3, Context * context, const void * auxiliary, float precision, int iterations) {
   if (iterations <= 0) {
     return false;
   }
@@ -443,8 +535,8 @@ bool Zoom::IsConvexAroundExtremum(ValueAtAbscissa evaluation, float x1, float x2
   float xm, ym;
   for (int i = 0; i < 2; i++) {
     xm = (x[i] + x2) / 2.f;
-    ym = evaluation(xm, context, auxiliary);
-    bool res = ((y[i] < ym) != (ym < y2)) ? IsConvexAroundExtremum(evaluation, x[i], xm, x2, y[i], ym, y2, context, auxiliary, iterations - 1) : std::fabs(ym - y[i]) >= std::fabs(y2 - ym);
+    ym = Round(evaluation(xm, context, auxiliary), precision);
+    bool res = ((y[i] < ym) != (ym < y2)) ? IsConvexAroundExtremum(evaluation, x[i], xm, x2, y[i], ym, y2, context, auxiliary, precision, iterations - 1) : std::fabs(ym - y[i]) >= std::fabs(y2 - ym);
     if (!res) {
       return false;
     }
@@ -484,4 +576,13 @@ void Zoom::ExpandSparseWindow(float * sample, int length, float * xMin, float *
   }
 }
 
+void Zoom::UseSamplesIfDenseOn(const Samples * samples, float xMin, float xMax, int numberOfSamples, ValueAtAbscissa * evaluation, const void ** auxiliary) {
+  if (samples && samples->areDenseOn(xMin, xMax, numberOfSamples)) {
+    *evaluation = [](float x, Context * context, const void * auxiliary) {
+      return static_cast<const Samples *>(auxiliary)->valueAt(x);
+    };
+    *auxiliary = samples;
+  }
+}
+
 }
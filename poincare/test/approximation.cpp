@@ -1,4 +1,8 @@
 #include <apps/shared/global_context.h>
+#include <poincare/variable_context.h>
+#include <quiz/stopwatch.h>
+#include <ion/timing.h>
+#include <stdio.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -271,6 +275,8 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("det([[1,23,3][4,5,6][7,8,9]])", "126", Degree, Metric, Cartesian, 6); // FIXME: the determinant computation is not precised enough to be displayed with 7 significant digits
   assert_expression_approximates_to<double>("det([[1,23,3][4,5,6][7,8,9]])", "126");
+  assert_expression_approximates_to<double>("det([[1,2,3,4][5,6,7,8][2,-1,0,3][1,1,-1,1]])", "-80");
+  assert_expression_approximates_to<double>("det([[1,2,3,4][5,6,7,8][9,10,11,12][13,14,15,16]])", "0");
 
   assert_expression_approximates_to<float>("det([[𝐢,23-2𝐢,3×𝐢][4+𝐢,5×𝐢,6][7,8×𝐢+2,9]])", "126-231×𝐢", Degree, Metric, Cartesian, 6); // FIXME: the determinant computation is not precised enough to be displayed with 7 significant digits
   assert_expression_approximates_to<double>("det([[𝐢,23-2𝐢,3×𝐢][4+𝐢,5×𝐢,6][7,8×𝐢+2,9]])", "126-231×𝐢");
@@ -389,6 +395,7 @@ QUIZ_CASE(poincare_approximation_function) {
   assert_expression_approximates_to<float>("factor(𝐢)", "undef");
 
   assert_expression_approximates_to<float>("inverse([[1,2,3][4,5,-6][7,8,9]])", "[[-1.2917,-0.083333,0.375][1.0833,0.16667,-0.25][0.041667,-0.083333,0.041667]]", Degree, Metric, Cartesian, 5); // inverse is not precise enough to display 7 significative digits
+  assert_expression_approximates_to<double>("inverse([[1,2,3,4][5,6,7,8][2,-1,0,3][1,1,-1,1]])", "[[-0.675,0.275,0.2,-0.1][0.075,0.025,-0.3,0.4][-0.125,0.125,0,-0.5][0.475,-0.175,0.1,0.2]]");
   assert_expression_approximates_to<double>("inverse([[1,2,3][4,5,-6][7,8,9]])", "[[-1.2916666666667,-8.3333333333333ᴇ-2,0.375][1.0833333333333,1.6666666666667ᴇ-1,-0.25][4.1666666666667ᴇ-2,-8.3333333333333ᴇ-2,4.1666666666667ᴇ-2]]");
   assert_expression_approximates_to<float>("inverse([[𝐢,23-2𝐢,3×𝐢][4+𝐢,5×𝐢,6][7,8×𝐢+2,9]])", "[[-0.0118-0.0455×𝐢,-0.5-0.727×𝐢,0.318+0.489×𝐢][0.0409+0.00364×𝐢,0.04-0.0218×𝐢,-0.0255+0.00091×𝐢][0.00334-0.00182×𝐢,0.361+0.535×𝐢,-0.13-0.358×𝐢]]", Degree, Metric, Cartesian, 3); // inverse is not precise enough to display 7 significative digits
   assert_expression_approximates_to<double>("inverse([[𝐢,23-2𝐢,3×𝐢][4+𝐢,5×𝐢,6][7,8×𝐢+2,9]])", "[[-0.0118289353958-0.0454959053685×𝐢,-0.500454959054-0.727024567789×𝐢,0.31847133758+0.488626023658×𝐢][0.0409463148317+3.63967242948ᴇ-3×𝐢,0.0400363967243-0.0218380345769×𝐢,-0.0254777070064+9.0991810737ᴇ-4×𝐢][3.33636639369ᴇ-3-1.81983621474ᴇ-3×𝐢,0.36093418259+0.534728541098×𝐢,-0.130118289354-0.357597816197×𝐢]]", Degree, Metric, Cartesian, 12); // FIXME: inverse is not precise enough to display 14 significative digits
@@ -1014,6 +1021,86 @@ QUIZ_CASE(poincare_approximation_mix) {
   //assert_expression_simplifies_approximates_to<float>("1.0092^(50)×ln(3/2)", "6.4093734888993ᴇ-1"); TODO does not work
 }
 
+// Approximate e with x = value through the evaluations built in the pool
+template<typename T>
+T approximate_with_evaluations(Expression e, T value, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  VariableContext variableContext("x", context);
+  variableContext.setApproximationForVariable<T>(value);
+  Expression::SetEncounteredComplex(false);
+  const ExpressionNode * node = static_cast<const ExpressionNode *>(static_cast<const TreeHandle &>(e).node());
+  Evaluation<T> evaluation = node->approximate(T(), ExpressionNode::ApproximationContext(&variableContext, complexFormat, angleUnit));
+  if (complexFormat == Real && Expression::EncounteredComplex()) {
+    return NAN;
+  }
+  return evaluation.toScalar();
+}
+
+template<typename T>
+void assert_scalar_approximation_matches_evaluations(const char * expression, bool simplify, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  constexpr T values[] = {-10.0, -2.5, -1.0, -0.5, 0.0, 0.3, 1.0, 2.0, 7.5, 100.0};
+  Shared::GlobalContext globalContext;
+  Expression e = simplify ?
+    Expression::ParseAndSimplify(expression, &globalContext, complexFormat, angleUnit, Metric) :
+    parse_expression(expression, &globalContext, false);
+  for (T value : values) {
+    T scalar = e.approximateWithValueForSymbol<T>("x", value, &globalContext, complexFormat, angleUnit);
+    T reference = approximate_with_evaluations<T>(e, value, &globalContext, complexFormat, angleUnit);
+    quiz_assert_print_if_failure((std::isnan(scalar) && std::isnan(reference)) || scalar == reference, expression);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_scalar) {
+  const char * expressions[] = {
+    "3x^2-2x+1", "1/x", "x^(-2)", "x^(1/3)", "x^(2/3)", "√(x)", "root(x,3)",
+    "ln(x)", "log(x)", "log(x,2)", "log(-x,-2)", "ℯ^(-x^2)", "sin(x)^2+cos(x)",
+    "tan(x)/x", "acos(x/10)", "asin(x)", "atan(x)", "cosh(x)+sinh(x)-tanh(x)",
+    "abs(x-1)", "floor(x)+ceil(x)+frac(x)", "sign(x)", "x!", "arg(x)",
+    "conj(x×𝐢)", "re(x+𝐢)", "im(x×𝐢)", "√(x)^2", "(𝐢x)^2", "π×x", "0.1x-3",
+    "int(t,t,0,x)", "[[x,1]]", "det([[x,1][2,x]])",
+  };
+  Preferences::ComplexFormat complexFormats[] = {Real, Cartesian};
+  Preferences::AngleUnit angleUnits[] = {Radian, Degree};
+  for (const char * expression : expressions) {
+    for (Preferences::ComplexFormat complexFormat : complexFormats) {
+      for (Preferences::AngleUnit angleUnit : angleUnits) {
+        for (int simplify = 0; simplify < 2; simplify++) {
+          assert_scalar_approximation_matches_evaluations<float>(expression, simplify, complexFormat, angleUnit);
+          assert_scalar_approximation_matches_evaluations<double>(expression, simplify, complexFormat, angleUnit);
+        }
+      }
+    }
+  }
+}
+
+static void print_evaluations_per_second(const char * title, uint64_t startTime, int numberOfEvaluations) {
+  uint64_t duration = Ion::Timing::millis() - startTime;
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%s: %d evaluations/s", title, duration > 0 ? (int)(1000 * (uint64_t)numberOfEvaluations / duration) : -1);
+  quiz_print(buffer);
+}
+
+QUIZ_CASE(poincare_approximation_scalar_benchmark) {
+  constexpr int k_numberOfEvaluations = 20000;
+  const char * expressions[] = {"3x^3-2x+1", "sin(x)^2+ln(x)/√(x)", "ℯ^(-x^2/2)/√(2π)"};
+  Shared::GlobalContext globalContext;
+  for (const char * expression : expressions) {
+    quiz_print(expression);
+    Expression e = Expression::ParseAndSimplify(expression, &globalContext, Real, Radian, Metric);
+    float sum = 0.0f;
+    uint64_t startTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfEvaluations; i++) {
+      sum += approximate_with_evaluations<float>(e, 0.001f * i, &globalContext, Real, Radian);
+    }
+    print_evaluations_per_second("  evaluations", startTime, k_numberOfEvaluations);
+    float scalarSum = 0.0f;
+    startTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfEvaluations; i++) {
+      scalarSum += e.approximateWithValueForSymbol<float>("x", 0.001f * i, &globalContext, Real, Radian);
+    }
+    print_evaluations_per_second("  scalar", startTime, k_numberOfEvaluations);
+    quiz_assert_print_if_failure(sum == scalarSum || (std::isnan(sum) && std::isnan(scalarSum)), expression);
+  }
+}
 
 template void assert_expression_approximates_to_scalar(const char * expression, float approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 template void assert_expression_approximates_to_scalar(const char * expression, double approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
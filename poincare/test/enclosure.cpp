@@ -0,0 +1,106 @@
+#include <poincare/enclosure.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+typedef Enclosure::Status Status;
+
+bool bound_is(double bound, double expected) {
+  return std::isinf(expected) ? bound == expected : std::fabs(bound - expected) <= 1e-12 * (1.0 + std::fabs(expected));
+}
+
+void assert_enclosure_is(const char * definition, double xMin, double xMax, Status status, double min = NAN, double max = NAN, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(definition, &globalContext, false);
+  Enclosure enclosure = Enclosure::ForExpression(e, "x", xMin, xMax, angleUnit);
+  quiz_assert_print_if_failure(enclosure.status() == status, definition);
+  if (!std::isnan(min)) {
+    quiz_assert_print_if_failure(enclosure.min() <= min && bound_is(enclosure.min(), min), definition);
+  }
+  if (!std::isnan(max)) {
+    quiz_assert_print_if_failure(enclosure.max() >= max && bound_is(enclosure.max(), max), definition);
+  }
+}
+
+/* Split [xMin, xMax] in intervals, and check that the approximations on each
+ * interval lie within its enclosure. */
+void assert_enclosures_contain_approximations(const char * definition, double xMin, double xMax, bool simplify = false, Preferences::AngleUnit angleUnit = Radian) {
+  constexpr int k_numberOfIntervals = 37;
+  constexpr int k_numberOfSamples = 20;
+  Shared::GlobalContext globalContext;
+  Expression e = simplify ?
+    Expression::ParseAndSimplify(definition, &globalContext, Real, angleUnit, Metric) :
+    parse_expression(definition, &globalContext, false);
+  double step = (xMax - xMin) / k_numberOfIntervals;
+  for (int i = 0; i < k_numberOfIntervals; i++) {
+    double a = xMin + i * step;
+    double b = a + step;
+    Enclosure enclosure = Enclosure::ForExpression(e, "x", a, b, angleUnit);
+    quiz_assert_print_if_failure(enclosure.status() != Status::Unknown, definition);
+    for (int j = 0; j <= k_numberOfSamples; j++) {
+      double x = a + j * (b - a) / k_numberOfSamples;
+      double y = e.approximateWithValueForSymbol<double>("x", x, &globalContext, Real, angleUnit);
+      if (std::isnan(y)) {
+        quiz_assert_print_if_failure(enclosure.status() != Status::Defined, definition);
+      } else {
+        quiz_assert_print_if_failure(enclosure.status() != Status::Undefined && enclosure.contains(y), definition);
+      }
+    }
+  }
+}
+
+QUIZ_CASE(poincare_enclosure) {
+  constexpr double inf = INFINITY;
+  assert_enclosure_is("2", -1.0, 1.0, Status::Defined, 2.0, 2.0);
+  assert_enclosure_is("x", -1.0, 1.0, Status::Defined, -1.0, 1.0);
+  assert_enclosure_is("π", -1.0, 1.0, Status::Defined, M_PI, M_PI);
+  assert_enclosure_is("undef", -1.0, 1.0, Status::Undefined);
+  assert_enclosure_is("y", -1.0, 1.0, Status::Unknown);
+  assert_enclosure_is("random()", -1.0, 1.0, Status::Unknown);
+  assert_enclosure_is("3x-2", -1.0, 1.0, Status::Defined, -5.0, 1.0);
+  // The correlation between the children is lost
+  assert_enclosure_is("x-x", 0.0, 1.0, Status::Defined, -1.0, 1.0);
+  assert_enclosure_is("x^2", -1.0, 2.0, Status::Defined, 0.0, 4.0);
+  assert_enclosure_is("x^3", -1.0, 2.0, Status::Defined, -1.0, 8.0);
+  assert_enclosure_is("x^(-2)", -1.0, 2.0, Status::PartlyDefined, 0.25, inf);
+  assert_enclosure_is("1/x", 1.0, 2.0, Status::Defined, 0.5, 1.0);
+  assert_enclosure_is("1/x", 0.0, 2.0, Status::PartlyDefined, 0.5, inf);
+  assert_enclosure_is("1/x", -1.0, 2.0, Status::PartlyDefined, -inf, inf);
+  assert_enclosure_is("1/(x-x)", 0.0, 0.0, Status::Undefined);
+  assert_enclosure_is("√(x)", 1.0, 4.0, Status::Defined, 1.0, 2.0);
+  assert_enclosure_is("√(x)", -1.0, 4.0, Status::PartlyDefined, 0.0, 2.0);
+  assert_enclosure_is("√(x)", -4.0, -1.0, Status::Undefined);
+  assert_enclosure_is("x^(1/3)", -1.0, 8.0, Status::Unknown);
+  assert_enclosure_is("x^x", 1.0, 2.0, Status::Defined, 1.0, 4.0);
+  assert_enclosure_is("ℯ^x", 0.0, 1.0, Status::Defined, 1.0, M_E);
+  assert_enclosure_is("ln(x)", 1.0, M_E, Status::Defined, 0.0, 1.0);
+  assert_enclosure_is("ln(x)", -1.0, 1.0, Status::PartlyDefined, -inf, 0.0);
+  assert_enclosure_is("ln(x)", -2.0, -1.0, Status::Undefined);
+  assert_enclosure_is("log(x)", 1.0, 100.0, Status::Defined, 0.0, 2.0);
+  assert_enclosure_is("log(x,2)", 1.0, 8.0, Status::Defined, 0.0, 3.0);
+  assert_enclosure_is("abs(x)", -2.0, 1.0, Status::Defined, 0.0, 2.0);
+  assert_enclosure_is("sin(x)", 0.0, 1.0, Status::Defined, 0.0, std::sin(1.0));
+  assert_enclosure_is("sin(x)", 0.0, 2.0, Status::Defined, 0.0, 1.0);
+  assert_enclosure_is("sin(x)", -10.0, 10.0, Status::Defined, -1.0, 1.0);
+  assert_enclosure_is("cos(x)", -1.0, 4.0, Status::Defined, -1.0, 1.0);
+  assert_enclosure_is("cos(x)", 0.0, 180.0, Status::Defined, -1.0, 1.0, Degree);
+  assert_enclosure_is("cos(x)", 0.0, 100.0, Status::Defined, 0.0, 1.0, Gradian);
+  assert_enclosure_is("tan(x)", 0.0, 1.0, Status::Defined, 0.0, std::tan(1.0));
+  assert_enclosure_is("tan(x)", 1.0, 2.0, Status::PartlyDefined, -inf, inf);
+  assert_enclosure_is("sin(1/x)", -1.0, 1.0, Status::PartlyDefined, -1.0, 1.0);
+  assert_enclosure_is("√(x)+ln(-x)", -1.0, 1.0, Status::PartlyDefined);
+  assert_enclosure_is("√(x)+ln(x)", -2.0, -1.0, Status::Undefined);
+
+  assert_enclosures_contain_approximations("x^3-2x+1", -3.0, 3.0);
+  assert_enclosures_contain_approximations("1/(x-1)", -3.0, 3.0);
+  assert_enclosures_contain_approximations("1/(x-1)", -3.0, 3.0, true);
+  assert_enclosures_contain_approximations("√(x)", -3.0, 3.0, true);
+  assert_enclosures_contain_approximations("ℯ^(-x^2)", -3.0, 3.0, true);
+  assert_enclosures_contain_approximations("ln(x^2-1)", -3.0, 3.0, true);
+  assert_enclosures_contain_approximations("x×sin(1/x)", -1.0, 1.0, true);
+  assert_enclosures_contain_approximations("tan(x)", -10.0, 10.0, true);
+  assert_enclosures_contain_approximations("cos(x)/x", -10.0, 10.0, true, Degree);
+  assert_enclosures_contain_approximations("sin(x)^2+cos(x)", -360.0, 360.0, true, Degree);
+  assert_enclosures_contain_approximations("2^x-3×x", -5.0, 5.0, true);
+}
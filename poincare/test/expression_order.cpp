@@ -219,3 +219,21 @@ QUIZ_CASE(poincare_expression_order_addition_multiplication) {
     assert_multiplication_or_addition_is_ordered_as(e1, e2);
   }
 }
+
+void assert_large_addition_is_sorted(int numberOfTerms) {
+  // x^(7k mod n) terms, for k in [0, n[, are sorted by decreasing exponents
+  Addition e1 = Addition::Builder();
+  Addition e2 = Addition::Builder();
+  for (int k = 0; k < numberOfTerms; k++) {
+    e1.addChildAtIndexInPlace(Power::Builder(Symbol::Builder('x'), Rational::Builder((7 * k) % numberOfTerms + 1)), k, k);
+    e2.addChildAtIndexInPlace(Power::Builder(Symbol::Builder('x'), Rational::Builder(numberOfTerms - k)), k, k);
+  }
+  assert_multiplication_or_addition_is_ordered_as(e1, e2);
+}
+
+QUIZ_CASE(poincare_expression_order_large_addition) {
+  // Above 128 children, the children are sorted in the pool
+  assert_large_addition_is_sorted(40);
+  assert_large_addition_is_sorted(128);
+  assert_large_addition_is_sorted(130);
+}
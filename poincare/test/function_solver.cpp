@@ -1,4 +1,6 @@
 #include <apps/shared/global_context.h>
+#include <quiz/stopwatch.h>
+#include <initializer_list>
 #include "helper.h"
 
 using namespace Poincare;
@@ -291,3 +293,75 @@ QUIZ_CASE(poincare_function_intersection) {
     assert_points_of_interest_are(PointOfInterestType::Intersection, numberOfIntersections, intersections, "cos(a)", "0", "a", 500.0, -0.1, -1.0);
   }
 }
+
+void assert_roots_are(const char * expression, const char * symbol, double start, double step, double max, std::initializer_list<double> expectedRoots, int maxNumberOfRoots = 10) {
+  Shared::GlobalContext context;
+  Poincare::Expression e = parse_expression(expression, &context, false);
+  constexpr int k_bufferSize = 20;
+  assert(maxNumberOfRoots <= k_bufferSize);
+  double roots[k_bufferSize];
+  int numberOfRoots = e.roots(symbol, start, step, max, roots, maxNumberOfRoots, &context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Degree);
+  quiz_assert_log_if_failure(numberOfRoots == static_cast<int>(expectedRoots.size()), e);
+  int i = 0;
+  for (double root : expectedRoots) {
+    quiz_assert_log_if_failure(doubles_are_approximately_equal(root, roots[i++]), e);
+  }
+}
+
+QUIZ_CASE(poincare_function_roots) {
+  assert_roots_are("a^2-4", "a", -5.0, 0.1, 100.0, {-2.0, 2.0});
+  assert_roots_are("a^2", "a", -5.0, 0.1, 100.0, {0.0});
+  assert_roots_are("3", "a", -1.0, 0.1, 100.0, {});
+  assert_roots_are("ℯ^a", "a", -1000.0, 0.1, -800.0, {});
+  assert_roots_are("0", "a", -1.0, 0.1, 100.0, {-0.9, -0.8, -0.7}, 3);
+  assert_roots_are("cos(a)", "a", -1.0, 0.1, 500.0, {90.0, 270.0, 450.0});
+  assert_roots_are("cos(a)", "a", -1000.0, 1.0, 1000.0, {-990.0, -810.0, -630.0}, 3);
+  // Roots closer than the step
+  assert_roots_are("(a-1)(a-1.2)", "a", -10.0, 1.0, 10.0, {1.0, 1.2});
+  assert_roots_are("(a-1)(a-1.01)(a+3)", "a", -10.0, 1.0, 10.0, {-3.0, 1.0, 1.01});
+  assert_roots_are("(a-2)^2(a+1)", "a", -10.0, 1.0, 10.0, {-1.0, 2.0});
+  // Roots on the boundary of the definition domain
+  assert_roots_are("√(a)", "a", -10.0, 0.7, 10.0, {0.0});
+  assert_roots_are("a×ln(a)", "a", -10.0, 0.3, 10.0, {1.0});
+}
+
+static int numberOfRootsWithNextRoot(Poincare::Expression e, const char * symbol, double start, double step, double max, int maxNumberOfRoots, Poincare::Context * context) {
+  int numberOfRoots = 0;
+  double root = e.nextRoot(symbol, start, step, max, context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+  while (!std::isnan(root) && numberOfRoots < maxNumberOfRoots) {
+    numberOfRoots++;
+    root = e.nextRoot(symbol, root, step, max, context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+  }
+  return numberOfRoots;
+}
+
+QUIZ_CASE(poincare_function_roots_benchmark) {
+  /* Compare the single sweep of Expression::roots with successive calls to
+   * Expression::nextRoot on hard equations: the sweep must find at least as
+   * many roots. */
+  constexpr int k_maxNumberOfRoots = 11;
+  const char * expressions[] = {
+    "sin(a)",
+    "sin(a^2/10)",
+    "(a-1)(a-1.1)(a-3)(a+4)",
+    "tan(a)-a",
+    "a^3-a",
+    "cos(a)^2-1/2",
+  };
+  Shared::GlobalContext context;
+  for (const char * expression : expressions) {
+    Poincare::Expression e = parse_expression(expression, &context, false);
+    double start = -10.0;
+    double max = 10.0;
+    double step = (max - start) / 100.0;
+    quiz_print(expression);
+    uint64_t startTime = quiz_stopwatch_start();
+    int numberOfRootsSequential = numberOfRootsWithNextRoot(e, "a", start, step, max, k_maxNumberOfRoots, &context);
+    quiz_stopwatch_print_lap(startTime);
+    startTime = quiz_stopwatch_start();
+    double roots[k_maxNumberOfRoots];
+    int numberOfRoots = e.roots("a", start, step, max, roots, k_maxNumberOfRoots, &context, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Radian);
+    quiz_stopwatch_print_lap(startTime);
+    quiz_assert_log_if_failure(numberOfRoots >= numberOfRootsSequential, e);
+  }
+}
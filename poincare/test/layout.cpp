@@ -1,4 +1,5 @@
 #include <poincare_layouts.h>
+#include <quiz/stopwatch.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -165,3 +166,109 @@ QUIZ_CASE(poincare_layout_parentheses_size) {
   layout.addChildAtIndex(CodePointLayout::Builder('1'), 8, 8, nullptr);
   quiz_assert(leftPar.layoutSize().height() == rightPar.layoutSize().height());
 }
+
+void assert_layout_metrics_are_identical(Layout l1, Layout l2) {
+  quiz_assert(l1.numberOfChildren() == l2.numberOfChildren());
+  quiz_assert(l1.layoutSize() == l2.layoutSize());
+  quiz_assert(l1.baseline() == l2.baseline());
+  quiz_assert(l1.absoluteOrigin() == l2.absoluteOrigin());
+  for (int i = 0; i < l1.numberOfChildren(); i++) {
+    assert_layout_metrics_are_identical(l1.childAtIndex(i), l2.childAtIndex(i));
+  }
+}
+
+void assert_layout_metrics_are_up_to_date(Layout l) {
+  /* The clone is measured from scratch whereas the layout keeps the metrics
+   * that were not invalidated by the edits. */
+  assert_layout_metrics_are_identical(l, l.clone());
+}
+
+QUIZ_CASE(poincare_layout_incremental_measurement) {
+  HorizontalLayout layout = HorizontalLayout::Builder();
+  LayoutCursor cursor(layout);
+  bool shouldRecomputeLayout = false;
+  assert_layout_metrics_are_up_to_date(layout);
+
+  // (2+3
+  cursor.insertText("(2+3");
+  assert_layout_metrics_are_up_to_date(layout);
+
+  /*      3
+   * (2+-----
+   *     4+5
+   * The left parenthesis grows with its sibling fraction. */
+  cursor.addFractionLayoutAndCollapseSiblings();
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.insertText("4+5");
+  assert_layout_metrics_are_up_to_date(layout);
+
+  // The superscript follows its base, the right parenthesis.
+  cursor.moveRight(&shouldRecomputeLayout);
+  cursor.insertText(")");
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.addEmptySquarePowerLayout();
+  assert_layout_metrics_are_up_to_date(layout);
+
+  /*      3
+   * (2+-----)1
+   *     4+5
+   * Edit the denominator: the parentheses grow and the layouts on their right
+   * move. */
+  Layout denominator = LayoutHelper::String("4+5", 3);
+  layout = HorizontalLayout::Builder({
+      LeftParenthesisLayout::Builder(),
+      CodePointLayout::Builder('2'),
+      CodePointLayout::Builder('+'),
+      FractionLayout::Builder(CodePointLayout::Builder('3'), denominator),
+      RightParenthesisLayout::Builder(),
+      CodePointLayout::Builder('1')});
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor = LayoutCursor(denominator.childAtIndex(2));
+  cursor.addFractionLayoutAndCollapseSiblings();
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.insertText("67");
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.performBackspace();
+  assert_layout_metrics_are_up_to_date(layout);
+
+  // Matrix rows and columns are added and removed while editing
+  cursor = LayoutCursor(layout);
+  cursor.addEmptyMatrixLayout();
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.insertText("8");
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.moveRight(&shouldRecomputeLayout);
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.insertText("9");
+  assert_layout_metrics_are_up_to_date(layout);
+  cursor.moveRight(&shouldRecomputeLayout);
+  cursor.moveRight(&shouldRecomputeLayout);
+  cursor.showEmptyLayoutIfNeeded();
+  assert_layout_metrics_are_up_to_date(layout);
+}
+
+QUIZ_CASE(poincare_layout_keystroke_benchmark) {
+  /* Type characters at the end of a large layout and measure it after each
+   * keystroke, as the layout field does. The first lap only discards the
+   * metrics affected by the edits, the second one measures the whole layout
+   * from scratch after each keystroke. */
+  constexpr int k_numberOfKeystrokes = 100;
+  const char * expression = "[[1/2,3^4,√(5)][sum(k^2,k,1,10),int(x^2,x,0,1),(6+7/8)^9][log(10),root(11,12),binomial(13,14)]]/(15+(16/17)^18)";
+  for (int fromScratch = 0; fromScratch < 2; fromScratch++) {
+    HorizontalLayout layout = HorizontalLayout::Builder(parse_expression(expression, nullptr, false).createLayout(DecimalMode, PrintFloat::k_numberOfStoredSignificantDigits));
+    LayoutCursor cursor(layout);
+    KDCoordinate width = layout.layoutSize().width();
+    uint64_t startTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfKeystrokes; i++) {
+      cursor.insertText(i % 2 == 0 ? "+" : "1");
+      if (fromScratch) {
+        layout.invalidAllSizesPositionsAndBaselines();
+      }
+      width = layout.layoutSize().width();
+      cursor.middleLeftPoint();
+    }
+    quiz_stopwatch_print_lap(startTime);
+    assert_layout_metrics_are_up_to_date(layout);
+    quiz_assert(width > 0);
+  }
+}
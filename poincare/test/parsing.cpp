@@ -2,6 +2,7 @@
 #include <poincare/exception_checkpoint.h>
 #include <poincare/src/parsing/parser.h>
 #include <apps/shared/global_context.h>
+#include <quiz/stopwatch.h>
 #include "tree/helpers.h"
 #include "helper.h"
 
@@ -297,10 +298,13 @@ QUIZ_CASE(poincare_parsing_units) {
       quiz_assert_print_if_failure(unit.type() == ExpressionNode::Type::Unit, "Should be parsed as a Unit");
       if (rep->isInputPrefixable()) {
         for (size_t i = 0; i < Unit::Prefix::k_numberOfPrefixes; i++) {
-          const Unit::Prefix * pre = Unit::Prefix::Prefixes();
+          const Unit::Prefix * pre = Unit::Prefix::Prefixes() + i;
+          if (!rep->canPrefix(pre, true)) {
+            continue;
+          }
           Unit::Builder(rep, pre).serialize(buffer, bufferSize, Preferences::PrintFloatMode::Decimal, Preferences::VeryShortNumberOfSignificantDigits);
           Expression unit = parse_expression(buffer, nullptr, false);
-          quiz_assert_print_if_failure(unit.type() == ExpressionNode::Type::Unit, "Should be parsed as a Unit");
+          quiz_assert_print_if_failure(unit.isIdenticalTo(Unit::Builder(rep, pre)), buffer);
         }
       }
     }
@@ -309,6 +313,11 @@ QUIZ_CASE(poincare_parsing_units) {
   // Non-existing units are not parsable
   assert_text_not_parsable("_n");
   assert_text_not_parsable("_a");
+  assert_text_not_parsable("_km_");
+  assert_text_not_parsable("_kmin");
+  assert_text_not_parsable("_ms_");
+  assert_text_not_parsable("_dam2");
+  assert_text_not_parsable("_μ");
 
   // Any identifier starting with '_' is tokenized as a unit
   assert_tokenizes_as_unit("_m");
@@ -501,3 +510,41 @@ QUIZ_CASE(poincare_parsing_adding_missing_parentheses) {
   assert_parsed_expression_with_user_parentheses_is("-conj(2+3)", Opposite::Builder(Parenthesis::Builder(Conjugate::Builder(Addition::Builder(BasedInteger::Builder(2), BasedInteger::Builder(3))))));
   assert_parsed_expression_with_user_parentheses_is("conj(2+3)!", Factorial::Builder(Parenthesis::Builder(Conjugate::Builder(Addition::Builder(BasedInteger::Builder(2), BasedInteger::Builder(3))))));
 }
+
+QUIZ_CASE(poincare_parsing_benchmark) {
+  /* Time the parsing of expressions typical of the calculation history and of
+   * stored functions, which mostly consists in resolving identifiers. */
+  constexpr int k_numberOfRepetitions = 200;
+  const char * expressions[] = {
+    "3×cos(2x)+sin(x)^2-tan(π/4)",
+    "int(ln(x)×e^(-x),x,1,10)",
+    "sum(1/n^2,n,1,100)+product(1+1/k,k,1,10)",
+    "normcdf(1.96,0,1)-invnorm(0.975,0,1)",
+    "binomial(10,3)+permute(8,2)+gcd(36,48)+lcm(4,6)",
+    "arcsin(0.5)+arccos(0.5)+arctan(1)+sinh(1)+cosh(1)+tanh(1)",
+    "det([[1,2,3][4,5,6][7,8,10]])+trace(identity(3))",
+    "log(100)+log(8,2)+root(27,3)+√(16)+abs(-3)",
+    "floor(2.5)+ceil(2.5)+round(3.14159,2)+frac(2.5)",
+    "re(2+3𝐢)+im(2+3𝐢)+arg(𝐢)+conj(1+𝐢)",
+    "diff(x^3-2x,x,3)+quo(17,5)+rem(17,5)",
+    "u(n+1)+v(n)+w(2)+ans+undef+inf",
+    "3_km+200_m+1_mi+5_ft+2_in",
+    "1_kW×_h+3.6_MJ+2_eV+5_kJ",
+    "9.81_m×_s^-2×70_kg→_N",
+    "2_h+30_min+45_s+1_day+1_week",
+    "1_L+250_mL+1_cup+2_tbsp+3_tsp+1_gal",
+    "101325_Pa+1_atm+2_bar+5_kPa",
+    "300_K+20_°C+68_°F",
+    "f(x)+g(2)+ab+xyz+a1b2",
+  };
+  Shared::GlobalContext context;
+  for (const char * expression : expressions) {
+    quiz_print(expression);
+    uint64_t startTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfRepetitions; i++) {
+      Expression e = Expression::Parse(expression, &context);
+      quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+    }
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
@@ -54,6 +54,41 @@ QUIZ_CASE(poincare_rational_addition) {
   assert_add_to(Rational::Builder(1,2), Rational::Builder(1), Rational::Builder(3,2));
   assert_add_to(Rational::Builder("18446744073709551616","4294967296"), Rational::Builder(8,9), Rational::Builder("38654705672","9"));
   assert_add_to(Rational::Builder("18446744073709551616","4294967296"), Rational::Builder(-8,9), Rational::Builder("38654705656","9"));
+  // Operands of one digit
+  assert_add_to(Rational::Builder(1,6), Rational::Builder(1,10), Rational::Builder(4,15));
+  assert_add_to(Rational::Builder(1,6), Rational::Builder(-1,6), Rational::Builder(0));
+  assert_add_to(Rational::Builder(-1,6), Rational::Builder(1,3), Rational::Builder(1,6));
+  assert_add_to(Rational::Builder(1,6), Rational::Builder(-1,3), Rational::Builder(-1,6));
+  assert_add_to(Rational::Builder(-3,4), Rational::Builder(-5,4), Rational::Builder(-2));
+  assert_add_to(Rational::Builder("4294967295"), Rational::Builder("4294967295"), Rational::Builder("8589934590"));
+  assert_add_to(Rational::Builder("4294967295","4294967294"), Rational::Builder("1","4294967293"), Rational::Builder("18446744060824649729","18446744052234715142"));
+  assert_add_to(Rational::Builder("-4294967295","4294967294"), Rational::Builder("4294967294","4294967293"), Rational::Builder("1","18446744052234715142"));
+  // The numerator overflows two digits
+  assert_add_to(Rational::Builder("4294967295","4294967294"), Rational::Builder("4294967294","4294967293"), Rational::Builder("36893488113059364871","18446744052234715142"));
+  assert_add_to(Rational::Builder("-4294967295","4294967294"), Rational::Builder("-4294967294","4294967293"), Rational::Builder("-36893488113059364871","18446744052234715142"));
+}
+
+static inline void assert_multiply_to(const Rational i, const Rational j, const Rational k) {
+  quiz_assert(Rational::NaturalOrder(Rational::Multiplication(i, j), k) == 0);
+}
+
+QUIZ_CASE(poincare_rational_multiplication) {
+  assert_multiply_to(Rational::Builder(2,3), Rational::Builder(9,4), Rational::Builder(3,2));
+  assert_multiply_to(Rational::Builder(-2,3), Rational::Builder(3,2), Rational::Builder(-1));
+  assert_multiply_to(Rational::Builder(-2,3), Rational::Builder(-5,7), Rational::Builder(10,21));
+  assert_multiply_to(Rational::Builder(0), Rational::Builder(-5,7), Rational::Builder(0));
+  assert_multiply_to(Rational::Builder("4294967295"), Rational::Builder("4294967295","4294967294"), Rational::Builder("18446744065119617025","4294967294"));
+  assert_multiply_to(Rational::Builder("18446744073709551616","4294967297"), Rational::Builder(3,2), Rational::Builder("27670116110564327424","4294967297"));
+}
+
+QUIZ_CASE(poincare_rational_native_builder) {
+  assert_equal(Rational::Builder(-2147483647 - 1, 2), Rational::Builder("-1073741824"));
+  assert_equal(Rational::Builder(6, -2147483647 - 1), Rational::Builder("-3", "1073741824"));
+  assert_equal(Rational::Builder(0, -5), Rational::Builder(0));
+  quiz_assert(!Rational::Builder(0, -5).isNegative());
+  quiz_assert(!Rational::Multiplication(Rational::Builder(0), Rational::Builder(-1)).isNegative());
+  quiz_assert(Rational::Builder("4294967296", "8589934592").isHalf());
+  quiz_assert(Rational::Addition(Rational::Builder("4294967295"), Rational::Builder(1)).signedIntegerNumerator().isEqualTo(Integer("4294967296")));
 }
 
 static inline void assert_pow_to(const Rational i,const Integer j, const Rational k) {
@@ -1,4 +1,8 @@
 #include <ion/storage.h>
+#include <apps/shared/global_context.h>
+#include <poincare/print_int.h>
+#include <quiz/stopwatch.h>
+#include <string.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -1046,6 +1050,10 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("det([[1,2,3][4,5,6][7,8,9]])", "0");
   assert_parsed_expression_simplify_to("det([[1,2,3][4π,5,6][7,8,9]])", "24×π-24");
   assert_parsed_expression_simplify_to("det(identity(5))", "1");
+  assert_parsed_expression_simplify_to("det([[1,1/2,1/3,1/4][1/2,1/3,1/4,1/5][1/3,1/4,1/5,1/6][1/4,1/5,1/6,1/7]])", "1/6048000");
+  assert_parsed_expression_simplify_to("det([[1,1/2,1/3,1/4,1/5][1/2,1/3,1/4,1/5,1/6][1/3,1/4,1/5,1/6,1/7][1/4,1/5,1/6,1/7,1/8][1/5,1/6,1/7,1/8,1/9]])", "1/266716800000");
+  assert_parsed_expression_simplify_to("det([[1,2,3,4][5,6,7,8][2,-1,0,3][1,1,-1,1]])", "-80");
+  assert_parsed_expression_simplify_to("det([[1,2,3,4][5,6,7,8][9,10,11,12][13,14,15,16]])", "0");
 
   // Dimension
   assert_parsed_expression_simplify_to("dim(3)", "[[1,1]]");
@@ -1054,6 +1062,9 @@ QUIZ_CASE(poincare_simplification_matrix) {
   // Inverse
   assert_parsed_expression_simplify_to("inverse([[1/√(2),1/2,3][2,1,-3]])", Undefined::Name());
   assert_parsed_expression_simplify_to("inverse([[1,2][3,4]])", "[[-2,1][3/2,-1/2]]");
+  assert_parsed_expression_simplify_to("inverse([[1,2,3,4][5,6,7,8][2,-1,0,3][1,1,-1,1]])", "[[-27/40,11/40,1/5,-1/10][3/40,1/40,-3/10,2/5][-1/8,1/8,0,-1/2][19/40,-7/40,1/10,1/5]]");
+  assert_parsed_expression_simplify_to("inverse([[1,1/2,1/3,1/4][1/2,1/3,1/4,1/5][1/3,1/4,1/5,1/6][1/4,1/5,1/6,1/7]])", "[[16,-120,240,-140][-120,1200,-2700,1680][240,-2700,6480,-4200][-140,1680,-4200,2800]]");
+  assert_parsed_expression_simplify_to("inverse([[1,2,3,4][5,6,7,8][9,10,11,12][13,14,15,16]])", Undefined::Name());
   assert_parsed_expression_simplify_to("inverse([[π,2×π][3,2]])", "[[-1/\u00122×π\u0013,1/2][3/\u00124×π\u0013,-1/4]]");
 
   // Trace
@@ -1119,6 +1130,110 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("1/identity(2)^500", "1/[[1,0][0,1]]^500");
 }
 
+void fill_with_hilbert_matrix(const char * function, int dim, char * buffer, int bufferSize) {
+  // Write function([[1/1,1/2,...][1/2,1/3,...]...]) in buffer
+  int length = strlcpy(buffer, function, bufferSize);
+  length += strlcpy(buffer + length, "([", bufferSize - length);
+  for (int i = 0; i < dim; i++) {
+    buffer[length++] = '[';
+    for (int j = 0; j < dim; j++) {
+      if (j > 0) {
+        buffer[length++] = ',';
+      }
+      length += strlcpy(buffer + length, "1/", bufferSize - length);
+      length += PrintInt::Left(i + j + 1, buffer + length, bufferSize - length);
+    }
+    buffer[length++] = ']';
+  }
+  strlcpy(buffer + length, "])", bufferSize - length);
+}
+
+QUIZ_CASE(poincare_simplification_matrix_benchmark) {
+  /* Hilbert matrices are ill-conditioned and their exact determinants and
+   * inverses have large coefficients. Time their exact computation on growing
+   * sizes, as well as their approximation. */
+  constexpr int k_bufferSize = 1000;
+  char buffer[k_bufferSize];
+  const char * functions[] = {"det", "inverse"};
+  Shared::GlobalContext context;
+  for (int dim = 2; dim <= 8; dim++) {
+    for (const char * function : functions) {
+      fill_with_hilbert_matrix(function, dim, buffer, k_bufferSize);
+      Expression e = parse_expression(buffer, &context, false);
+      quiz_print(buffer);
+      uint64_t startTime = quiz_stopwatch_start();
+      Expression simplified = e.clone().simplify(ExpressionNode::ReductionContext(&context, Cartesian, Radian, Metric, User));
+      quiz_stopwatch_print_lap(startTime);
+      quiz_assert_print_if_failure(simplified.type() == ExpressionNode::Type::Rational || simplified.type() == ExpressionNode::Type::Matrix, buffer);
+      startTime = quiz_stopwatch_start();
+      Expression approximation = e.approximate<double>(&context, Cartesian, Radian);
+      quiz_stopwatch_print_lap(startTime);
+      quiz_assert_print_if_failure(!approximation.isUndefined(), buffer);
+    }
+  }
+}
+
+void fill_with_polynomial(int numberOfTerms, char * buffer, int bufferSize) {
+  // Write the sum of (k+1)x^(7k mod n)y^(k mod 5), whose terms do not merge
+  int length = 0;
+  for (int k = 0; k < numberOfTerms; k++) {
+    if (k > 0) {
+      buffer[length++] = '+';
+    }
+    length += PrintInt::Left(k + 1, buffer + length, bufferSize - length);
+    length += strlcpy(buffer + length, "x^", bufferSize - length);
+    length += PrintInt::Left((7 * k) % numberOfTerms + 1, buffer + length, bufferSize - length);
+    length += strlcpy(buffer + length, "y^", bufferSize - length);
+    length += PrintInt::Left(k % 5 + 1, buffer + length, bufferSize - length);
+  }
+  buffer[length] = 0;
+}
+
+QUIZ_CASE(poincare_simplification_polynomial_benchmark) {
+  /* Reducing a large addition sorts its children several times, each of them
+   * being a multiplication whose children are sorted too. */
+  constexpr int k_bufferSize = 2000;
+  char buffer[k_bufferSize];
+  Shared::GlobalContext context;
+  const int numbersOfTerms[] = {16, 32, 48, 64};
+  for (int numberOfTerms : numbersOfTerms) {
+    fill_with_polynomial(numberOfTerms, buffer, k_bufferSize);
+    Expression e = parse_expression(buffer, &context, false);
+    uint64_t startTime = quiz_stopwatch_start();
+    Expression simplified = e.simplify(ExpressionNode::ReductionContext(&context, Cartesian, Radian, Metric, User));
+    quiz_stopwatch_print_lap(startTime);
+    quiz_assert(simplified.type() == ExpressionNode::Type::Addition && simplified.numberOfChildren() == numberOfTerms);
+  }
+}
+
+QUIZ_CASE(poincare_simplification_school_benchmark) {
+  /* Most rationals met while reducing school expressions have a numerator and
+   * a denominator of one digit. */
+  const char * definitions[] = {
+    "1/2+1/3-1/6",
+    "3/4×(2/3-5/6)+7/8",
+    "(2/3)^3-1/9+5/27",
+    "1/6+1/10+1/15+1/21+1/28",
+    "x/2+x/3+x/6-2x/5",
+    "2/3×x^2-1/6×x+5/4+x^2/3-x/12",
+    "(x+1/2)(x-1/3)(2x+3/4)",
+    "√(12)/3+√(27)/6-√(48)/4",
+    "(1/3)×ln(8)-ln(2)/2+cos(π/3)",
+    "3/7×(14/9-2/21)^2",
+  };
+  constexpr int k_numberOfRepetitions = 20;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfRepetitions; i++) {
+    for (const char * definition : definitions) {
+      Expression e = parse_expression(definition, &context, false);
+      Expression simplified = e.simplify(ExpressionNode::ReductionContext(&context, Cartesian, Radian, Metric, User));
+      quiz_assert_print_if_failure(!simplified.isUninitialized() && !simplified.isUndefined(), definition);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
 QUIZ_CASE(poincare_simplification_functions_of_matrices) {
   assert_parsed_expression_simplify_to("abs([[1,-1][2,-3]])", "[[1,1][2,3]]");
   assert_parsed_expression_simplify_to("acos([[1/√(2),1/2][1,-1]])", "[[π/4,π/3][0,π]]");
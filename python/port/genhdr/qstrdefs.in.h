@@ -603,6 +603,8 @@ Q(x)
 Q(dx)
 Q(fft)
 Q(ifft)
+Q(rfft)
+Q(irfft)
 Q(a)
 Q(v)
 Q(linalg)
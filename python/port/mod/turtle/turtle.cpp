@@ -77,16 +77,24 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
   mp_float_t oldHeading = heading();
   mp_float_t length = std::fabs(angle * k_headingScale * radius);
   if (length > 1) {
+    // At maximal speed, the turtle icon is only drawn at the end of the circle
+    bool visible = m_visible;
+    if (m_speed == 0) {
+      erase();
+      m_visible = false;
+    }
     for (int i = 1; i < length; i++) {
       mp_float_t progress = i / length;
       // Move the turtle forward
       if (forward(1)) {
         // Keyboard interruption. Return now to let MicroPython process it.
+        m_visible = visible;
         return;
       }
       setHeadingPrivate(oldHeading+std::copysign(angle*progress, radius));
     }
     forward(1);
+    m_visible = visible;
     setHeading(oldHeading+angle);
   }
 }
@@ -112,20 +120,30 @@ bool Turtle::goTo(mp_float_t x, mp_float_t y) {
   mp_float_t length = principalDirection == PrincipalDirection::X ? xLength : yLength;
 
   if (length > 1) {
-    // Tweening function
-    for (int i = 1; i < length; i++) {
-      mp_float_t progress = i / length;
+    /* At maximal speed, the turtle icon is not drawn along the way, so the
+     * whole segment is drawn at once. */
+    if (m_speed == 0 && m_penDown && !isOutOfBounds() && !isOutOfBounds(x, y)) {
       erase();
-      /* We make sure that each pixel along the principal direction is drawn. If
-       * the computation of the position on the principal coordinate is done
-       * using a barycenter, roundings might skip some pixels, which results in
-       * a dotted line. */
-      mp_float_t currentX = xLength == 0 ? x : (principalDirection == PrincipalDirection::Y ? x * progress + oldx * (1 - progress) : oldx + (x > oldx ? i : -i));
-      mp_float_t currentY = yLength == 0 ? y : (principalDirection == PrincipalDirection::X ? y * progress + oldy * (1 - progress) : oldy + (y > oldy ? i : -i));
-      if (dot(currentX, currentY) || draw(false)) {
+      if (segment(x, y) || draw(false)) {
         // Keyboard interruption. Return now to let MicroPython process it.
         return true;
       }
+    } else {
+      // Tweening function
+      for (int i = 1; i < length; i++) {
+        mp_float_t progress = i / length;
+        erase();
+        /* We make sure that each pixel along the principal direction is drawn. If
+         * the computation of the position on the principal coordinate is done
+         * using a barycenter, roundings might skip some pixels, which results in
+         * a dotted line. */
+        mp_float_t currentX = xLength == 0 ? x : (principalDirection == PrincipalDirection::Y ? x * progress + oldx * (1 - progress) : oldx + (x > oldx ? i : -i));
+        mp_float_t currentY = yLength == 0 ? y : (principalDirection == PrincipalDirection::X ? y * progress + oldy * (1 - progress) : oldy + (y > oldy ? i : -i));
+        if (dot(currentX, currentY) || draw(false)) {
+          // Keyboard interruption. Return now to let MicroPython process it.
+          return true;
+        }
+      }
     }
   }
 
@@ -200,8 +218,8 @@ void Turtle::viewDidDisappear() {
   m_drawn = false;
 }
 
-bool Turtle::isOutOfBounds() const {
-  return absF(x()) > k_maxPosition || absF(y()) > k_maxPosition;
+bool Turtle::isOutOfBounds(mp_float_t x, mp_float_t y) const {
+  return absF(x) > k_maxPosition || absF(y) > k_maxPosition;
 };
 
 void Turtle::drawBg() {
@@ -369,13 +387,32 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
   // Draw the dot if the pen is down
   if (m_penDown && hasDotBuffers() && !isOutOfBounds()) {
     KDContext * ctx = KDIonContext::sharedContext();
-    KDRect rect(
-      position(x, y).translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)),
-      KDSize(m_penSize, m_penSize)
-    );
-    ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
+    ctx->blendRectWithMask(dotRect(x, y), m_color, m_dotMask, m_dotWorkingPixelBuffer);
   }
 
+  walkTo(x, y);
+  return micropython_port_vm_hook_loop();
+}
+
+bool Turtle::segment(mp_float_t x, mp_float_t y) {
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+
+  /* The line pushes each run of pixels of the segment at once. Its ends are
+   * covered by the round dots drawn at the vertices. */
+  KDIonContext::sharedContext()->drawThickLine(position(), position(x, y), m_penSize, m_color);
+
+  walkTo(x, y);
+  return micropython_port_vm_hook_loop();
+}
+
+KDRect Turtle::dotRect(mp_float_t x, mp_float_t y) const {
+  return KDRect(
+    position(x, y).translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)),
+    KDSize(m_penSize, m_penSize)
+  );
+}
+
+void Turtle::walkTo(mp_float_t x, mp_float_t y) {
   /* Increase the turtle's mileage. We need to make sure the mileage is not
    * overflowed, otherwise we might skip some msleeps in draw. */
   uint16_t additionalMileage = sqrt((x - m_x) * (x - m_x) + (y - m_y) * (y - m_y)) * 1000;
@@ -385,8 +422,6 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
 
   m_x = x;
   m_y = y;
-
-  return micropython_port_vm_hook_loop();
 }
 
 void Turtle::drawPaw(PawType type, PawPosition pos) {
@@ -96,7 +96,7 @@ public:
    * coordinate overflows. However, this solution makes the turtle go faster
    * when out of bound, and can prevent text that would have been visible to be
    * drawn. We use very large bounds to temper these effects. */
-  bool isOutOfBounds() const;
+  bool isOutOfBounds() const { return isOutOfBounds(m_x, m_y); }
   void drawBg();
 
 private:
@@ -130,6 +130,7 @@ private:
   };
 
   void setHeadingPrivate(mp_float_t angle);
+  bool isOutOfBounds(mp_float_t x, mp_float_t y) const;
   KDPoint position(mp_float_t x, mp_float_t y) const;
   KDPoint position() const { return position(m_x, m_y); }
 
@@ -142,6 +143,12 @@ private:
   // Interruptible methods that return true if they have been interrupted
   bool draw(bool force);
   bool dot(mp_float_t x, mp_float_t y);
+  /* segment draws the line from the current position to (x, y) at once,
+   * instead of a dot per pixel, when the turtle icon is not drawn along the
+   * way. */
+  bool segment(mp_float_t x, mp_float_t y);
+  KDRect dotRect(mp_float_t x, mp_float_t y) const;
+  void walkTo(mp_float_t x, mp_float_t y);
 
   void drawPaw(PawType type, PawPosition position);
   void erase();
@@ -593,6 +593,18 @@ bool ndarray_is_dense(ndarray_obj_t *ndarray) {
     return stride == ndarray->strides[ULAB_MAX_DIMS-ndarray->ndim] ? true : false;
 }
 
+bool ndarray_is_contiguous(ndarray_obj_t *ndarray) {
+    // returns true, if the elements are stored one after the other in the order of iteration
+    int32_t stride = ndarray->itemsize;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        if(ndarray->strides[i - 1] != stride) {
+            return false;
+        }
+        stride *= ndarray->shape[i - 1];
+    }
+    return true;
+}
+
 
 ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype) {
     // Creates the base ndarray with shape, and initialises the values to straight 0s
@@ -143,6 +143,7 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t , size_t *, int32_t *, uint8_t );
 ndarray_obj_t *ndarray_new_linear_array(size_t , uint8_t );
 ndarray_obj_t *ndarray_new_view(ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t );
 bool ndarray_is_dense(ndarray_obj_t *);
+bool ndarray_is_contiguous(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *, uint8_t );
 void ndarray_copy_array(ndarray_obj_t *, ndarray_obj_t *, uint8_t );
@@ -88,10 +88,52 @@ static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj, 1, 2, fft_ifft);
 #endif
 
+#if !(ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE)
+#if ULAB_FFT_HAS_RFFT
+//| def rfft(r: ulab.numpy.ndarray) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of real values whose size is a power of 2
+//|     :return tuple (r, c): The real and complex parts of the non-negative frequency terms of the FFT
+//|
+//|     Perform a Fast Fourier Transform of a real signal. The result has len(r) // 2 + 1 elements,
+//|     and is computed with a transform of half the length of the signal."""
+//|     ...
+//|
+
+MP_DEFINE_CONST_FUN_OBJ_1(fft_rfft_obj, fft_rfft);
+#endif
+
+#if ULAB_FFT_HAS_IRFFT
+//| def irfft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of values whose size is a power of 2, plus one
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values of the same size, giving the complex part of the value
+//|     :return ulab.numpy.ndarray: The real signal of length 2 * (len(r) - 1)
+//|
+//|     Perform the inverse of `rfft`"""
+//|     ...
+//|
+
+static mp_obj_t fft_irfft_(size_t n_args, const mp_obj_t *args) {
+    return fft_irfft(n_args, args[0], n_args == 2 ? args[1] : mp_const_none);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_irfft_obj, 1, 2, fft_irfft_);
+#endif
+#endif
+
 STATIC const mp_rom_map_elem_t ulab_fft_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_fft) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_fft), (mp_obj_t)&fft_fft_obj },
     { MP_OBJ_NEW_QSTR(MP_QSTR_ifft), (mp_obj_t)&fft_ifft_obj },
+    #if !(ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE)
+    #if ULAB_FFT_HAS_RFFT
+    { MP_OBJ_NEW_QSTR(MP_QSTR_rfft), (mp_obj_t)&fft_rfft_obj },
+    #endif
+    #if ULAB_FFT_HAS_IRFFT
+    { MP_OBJ_NEW_QSTR(MP_QSTR_irfft), (mp_obj_t)&fft_irfft_obj },
+    #endif
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ulab_fft_globals, ulab_fft_globals_table);
@@ -24,37 +24,82 @@
 #define MP_E MICROPY_FLOAT_CONST(2.71828182845904523536)
 #endif
 
-/* Kernel implementation for the case, when ulab has no complex support
+/* The sines sin(2 pi k / len) for 0 <= k <= len / 4, from which all the
+ * twiddle factors of transforms of length up to len are read. A single table
+ * is kept on the heap, and replaced by a longer one when needed. */
+typedef struct _fft_twiddles_t {
+    size_t len;
+    mp_float_t sin[];
+} fft_twiddles_t;
 
- * The following function takes two arrays, namely, the real and imaginary
- * parts of a complex array, and calculates the Fourier transform in place.
- *
- * The function is basically a modification of four1 from Numerical Recipes,
- * has no dependencies beyond micropython itself (for the definition of mp_float_t),
- * and can be used independent of ulab.
- */
-
-#if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
-/* Kernel implementation for the complex case. Data are contained in data as
+static fft_twiddles_t *fft_twiddles(size_t len) {
+    fft_twiddles_t *twiddles = MP_STATE_PORT(ulab_fft_twiddles);
+    if(twiddles != NULL && twiddles->len >= len) {
+        return twiddles;
+    }
+    if(len > ULAB_FFT_TWIDDLE_TABLE_MAX_LENGTH) {
+        return NULL;
+    }
+    if(len < 4) {
+        len = 4;
+    }
+    if(twiddles != NULL) {
+        m_del_var(fft_twiddles_t, mp_float_t, twiddles->len / 4 + 1, twiddles);
+        MP_STATE_PORT(ulab_fft_twiddles) = NULL;
+    }
+    // The transform can do without the table, the allocation must not raise
+    twiddles = m_new_obj_var_maybe(fft_twiddles_t, mp_float_t, len / 4 + 1);
+    if(twiddles == NULL) {
+        return NULL;
+    }
+    twiddles->len = len;
+    for(size_t k = 0; k <= len / 4; k++) {
+        twiddles->sin[k] = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(2.0) * MP_PI * k / len);
+    }
+    MP_STATE_PORT(ulab_fft_twiddles) = twiddles;
+    return twiddles;
+}
 
-    data[0], data[1], data[2], data[3], .... , data[2n - 2], data[2n-1]
-    real[0], imag[0], real[1], imag[1], .... , real[n-1],    imag[n-1]
+// Sets *c and *s to cos(2 pi k / len) and sin(2 pi k / len), for k < len / 2
+static void fft_twiddle(fft_twiddles_t *twiddles, size_t k, size_t len, mp_float_t *c, mp_float_t *s) {
+    if(twiddles == NULL) {
+        mp_float_t theta = MICROPY_FLOAT_CONST(2.0) * MP_PI * k / len;
+        *c = MICROPY_FLOAT_C_FUN(cos)(theta);
+        *s = MICROPY_FLOAT_C_FUN(sin)(theta);
+        return;
+    }
+    k *= twiddles->len / len;
+    size_t quarter = twiddles->len / 4;
+    if(k <= quarter) {
+        *c = twiddles->sin[quarter - k];
+        *s = twiddles->sin[k];
+    } else {
+        *c = -twiddles->sin[k - quarter];
+        *s = twiddles->sin[2 * quarter - k];
+    }
+}
 
-    In general
-    real[i] = data[2i]
-    imag[i] = data[2i+1]
+/* Kernel implementation
 
-*/
-void fft_kernel_complex(mp_float_t *data, size_t n, int isign) {
+ * The following function takes the real and imaginary parts of a complex
+ * array, whose elements are stride floats apart, and calculates the Fourier
+ * transform in place.
+ *
+ * The function is basically a modification of four1 from Numerical Recipes.
+ * The twiddle factors are read from the table when it could be allocated,
+ * and computed with the recurrence of four1 otherwise.
+ */
+static void fft_kernel_strided(mp_float_t *real, mp_float_t *imag, size_t stride, size_t n, int isign) {
     size_t j, m, mmax, istep;
     mp_float_t tempr, tempi;
     mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+    fft_twiddles_t *twiddles = fft_twiddles(n);
 
     j = 0;
     for(size_t i = 0; i < n; i++) {
         if (j > i) {
-            SWAP(mp_float_t, data[2*i], data[2*j]);
-            SWAP(mp_float_t, data[2*i+1], data[2*j+1]);
+            SWAP(mp_float_t, real[stride*i], real[stride*j]);
+            SWAP(mp_float_t, imag[stride*i], imag[stride*j]);
         }
         m = n >> 1;
         while (j >= m && m > 0) {
@@ -67,30 +112,54 @@ void fft_kernel_complex(mp_float_t *data, size_t n, int isign) {
     mmax = 1;
     while (n > mmax) {
         istep = mmax << 1;
-        theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
-        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
-        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
-        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        wpr = wpi = MICROPY_FLOAT_CONST(0.0);
+        if(twiddles == NULL) {
+            theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
+            wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+            wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+            wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        }
         wr = MICROPY_FLOAT_CONST(1.0);
         wi = MICROPY_FLOAT_CONST(0.0);
         for(m = 0; m < mmax; m++) {
+            if(twiddles != NULL) {
+                fft_twiddle(twiddles, m, istep, &wr, &wi);
+                wi = -isign * wi;
+            }
             for(size_t i = m; i < n; i += istep) {
                 j = i + mmax;
-                tempr = wr * data[2*j] - wi * data[2*j+1];
-                tempi = wr * data[2*j+1] + wi * data[2*j];
-                data[2*j] = data[2*i] - tempr;
-                data[2*j+1] = data[2*i+1] - tempi;
-                data[2*i] += tempr;
-                data[2*i+1] += tempi;
+                tempr = wr * real[stride*j] - wi * imag[stride*j];
+                tempi = wr * imag[stride*j] + wi * real[stride*j];
+                real[stride*j] = real[stride*i] - tempr;
+                imag[stride*j] = imag[stride*i] - tempi;
+                real[stride*i] += tempr;
+                imag[stride*i] += tempi;
+            }
+            if(twiddles == NULL) {
+                wtemp = wr;
+                wr = wr*wpr - wi*wpi + wr;
+                wi = wi*wpr + wtemp*wpi + wi;
             }
-            wtemp = wr;
-            wr = wr*wpr - wi*wpi + wr;
-            wi = wi*wpr + wtemp*wpi + wi;
         }
         mmax = istep;
     }
 }
 
+#if ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE
+/* Kernel implementation for the complex case. Data are contained in data as
+
+    data[0], data[1], data[2], data[3], .... , data[2n - 2], data[2n-1]
+    real[0], imag[0], real[1], imag[1], .... , real[n-1],    imag[n-1]
+
+    In general
+    real[i] = data[2i]
+    imag[i] = data[2i+1]
+
+*/
+void fft_kernel_complex(mp_float_t *data, size_t n, int isign) {
+    fft_kernel_strided(data, data + 1, 2, n, isign);
+}
+
 /*
  * The following function is a helper interface to the python side.
  * It has been factored out from fft.c, so that the same argument parsing
@@ -157,49 +226,116 @@ mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t data_in, uint8_t type) {
 }
 #else /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
 void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
-    size_t j, m, mmax, istep;
-    mp_float_t tempr, tempi;
-    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+    fft_kernel_strided(real, imag, 1, n, isign);
+}
 
-    j = 0;
-    for(size_t i = 0; i < n; i++) {
-        if (j > i) {
-            SWAP(mp_float_t, real[i], real[j]);
-            SWAP(mp_float_t, imag[i], imag[j]);
+/* Real transforms
+
+ * A real signal x of length 2h is transformed as the complex signal
+ * z[k] = x[2k] + i x[2k+1] of length h. With W = exp(-2 i pi / 2h), the
+ * transform X of x is recovered from the transform Z of z as
+ *
+ *     X[k] = E + W^k O, X[h-k] = conj(E - W^k O)
+ *     with E = (Z[k] + conj(Z[h-k])) / 2 and O = -i (Z[k] - conj(Z[h-k])) / 2
+ *
+ * X[0] and X[h] are real. fft_real_unpack computes X[0], ..., X[h-1] in place
+ * of Z and returns X[h], fft_real_pack is its inverse.
+ */
+static mp_float_t fft_real_unpack(mp_float_t *real, mp_float_t *imag, size_t stride, size_t h, fft_twiddles_t *twiddles) {
+    mp_float_t xh = real[0] - imag[0];
+    real[0] += imag[0];
+    imag[0] = MICROPY_FLOAT_CONST(0.0);
+    for(size_t k = 1; k <= h / 2; k++) {
+        size_t i = stride * k, j = stride * (h - k);
+        mp_float_t er = (real[i] + real[j]) / 2, ei = (imag[i] - imag[j]) / 2;
+        mp_float_t or = (imag[i] + imag[j]) / 2, oi = (real[j] - real[i]) / 2;
+        mp_float_t c, s;
+        fft_twiddle(twiddles, k, 2 * h, &c, &s);
+        // W^k O, with W^k = c - i s
+        mp_float_t wor = c * or + s * oi, woi = c * oi - s * or;
+        real[i] = er + wor;
+        imag[i] = ei + woi;
+        real[j] = er - wor;
+        imag[j] = woi - ei;
+    }
+    return xh;
+}
+
+static void fft_real_pack(mp_float_t *real, mp_float_t *imag, size_t stride, size_t h, mp_float_t xh, fft_twiddles_t *twiddles) {
+    mp_float_t x0 = real[0];
+    real[0] = (x0 + xh) / 2;
+    imag[0] = (x0 - xh) / 2;
+    for(size_t k = 1; k <= h / 2; k++) {
+        size_t i = stride * k, j = stride * (h - k);
+        mp_float_t er = (real[i] + real[j]) / 2, ei = (imag[i] - imag[j]) / 2;
+        mp_float_t dr = (real[i] - real[j]) / 2, di = (imag[i] + imag[j]) / 2;
+        mp_float_t c, s;
+        fft_twiddle(twiddles, k, 2 * h, &c, &s);
+        // O = conj(W^k) (X[k] - conj(X[h-k])) / 2, with conj(W^k) = c + i s
+        mp_float_t or = c * dr - s * di, oi = c * di + s * dr;
+        // Z[k] = E + i O, Z[h-k] = conj(E) + i conj(O)
+        real[i] = er - oi;
+        imag[i] = ei + or;
+        real[j] = er + oi;
+        imag[j] = or - ei;
+    }
+}
+
+// Stores the even elements of the real ndarray in in real, the odd ones in imag
+static void fft_load_real(ndarray_obj_t *in, mp_float_t *real, mp_float_t *imag, size_t stride) {
+    uint8_t *array = (uint8_t *)in->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(in->dtype);
+    for(size_t i = 0; i < in->len / 2; i++) {
+        real[stride*i] = func(array);
+        array += in->strides[ULAB_MAX_DIMS - 1];
+        imag[stride*i] = func(array);
+        array += in->strides[ULAB_MAX_DIMS - 1];
+    }
+}
+
+/* The transform of a real signal of length len is computed with a transform
+ * of length len / 2. The spectrum is computed in place of the interleaved
+ * transform, so that a single ndarray is allocated. */
+static mp_obj_t fft_real_fft_spectrogram(ndarray_obj_t *in, uint8_t type) {
+    size_t len = in->len;
+    size_t h = len / 2;
+    fft_twiddles_t *twiddles = fft_twiddles(len);
+
+    if(type == FFT_SPECTROGRAM) {
+        ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+        mp_float_t *data = (mp_float_t *)out->array;
+        fft_load_real(in, data, data + 1, 2);
+        fft_kernel_strided(data, data + 1, 2, h, 1);
+        mp_float_t xh = fft_real_unpack(data, data + 1, 2, h, twiddles);
+        // |X[k]| is stored in data[k], whose transform data[2k] was already read
+        data[0] = MICROPY_FLOAT_C_FUN(fabs)(data[0]);
+        for(size_t k = 1; k < h; k++) {
+            data[k] = MICROPY_FLOAT_C_FUN(sqrt)(data[2*k] * data[2*k] + data[2*k+1] * data[2*k+1]);
         }
-        m = n >> 1;
-        while (j >= m && m > 0) {
-            j -= m;
-            m >>= 1;
+        data[h] = MICROPY_FLOAT_C_FUN(fabs)(xh);
+        for(size_t k = 1; k < h; k++) {
+            data[len - k] = data[k];
         }
-        j += m;
+        return MP_OBJ_FROM_PTR(out);
     }
 
-    mmax = 1;
-    while (n > mmax) {
-        istep = mmax << 1;
-        theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
-        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
-        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
-        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
-        wr = MICROPY_FLOAT_CONST(1.0);
-        wi = MICROPY_FLOAT_CONST(0.0);
-        for(m = 0; m < mmax; m++) {
-            for(size_t i = m; i < n; i += istep) {
-                j = i + mmax;
-                tempr = wr * real[j] - wi * imag[j];
-                tempi = wr * imag[j] + wi * real[j];
-                real[j] = real[i] - tempr;
-                imag[j] = imag[i] - tempi;
-                real[i] += tempr;
-                imag[i] += tempi;
-            }
-            wtemp = wr;
-            wr = wr*wpr - wi*wpi + wr;
-            wi = wi*wpr + wtemp*wpi + wi;
-        }
-        mmax = istep;
+    ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    ndarray_obj_t *out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    fft_load_real(in, data_re, data_im, 1);
+    fft_kernel_strided(data_re, data_im, 1, h, 1);
+    data_re[h] = fft_real_unpack(data_re, data_im, 1, h, twiddles);
+    data_im[h] = MICROPY_FLOAT_CONST(0.0);
+    // The transform of a real signal is hermitian
+    for(size_t k = h + 1; k < len; k++) {
+        data_re[k] = data_re[len - k];
+        data_im[k] = -data_im[len - k];
     }
+    mp_obj_t tuple[2];
+    tuple[0] = out_re;
+    tuple[1] = out_im;
+    return mp_obj_new_tuple(2, tuple);
 }
 
 mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type) {
@@ -224,6 +360,10 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
         mp_raise_ValueError(translate("input array length must be power of 2"));
     }
 
+    if((n_args == 1) && (type != FFT_IFFT) && (len > 1)) {
+        return fft_real_fft_spectrogram(re, type);
+    }
+
     ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
     mp_float_t *data_re = (mp_float_t *)out_re->array;
 
@@ -284,4 +424,91 @@ mp_obj_t fft_fft_ifft_spectrogram(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_i
         return mp_obj_new_tuple(2, tuple);
     }
 }
+
+#if ULAB_FFT_HAS_RFFT
+mp_obj_t fft_rfft(mp_obj_t arg) {
+    if(!mp_obj_is_type(arg, &ulab_ndarray_type)) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *in = MP_OBJ_TO_PTR(arg);
+    #if ULAB_MAX_DIMS > 1
+    if(in->ndim != 1) {
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(in->dtype)
+        mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+    }
+    #endif
+    size_t len = in->len;
+    if((len == 0) || ((len & (len-1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be power of 2"));
+    }
+    size_t h = len / 2;
+    fft_twiddles_t *twiddles = fft_twiddles(len);
+
+    ndarray_obj_t *out_re = ndarray_new_linear_array(h + 1, NDARRAY_FLOAT);
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    ndarray_obj_t *out_im = ndarray_new_linear_array(h + 1, NDARRAY_FLOAT);
+    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    if(len == 1) {
+        data_re[0] = ndarray_get_float_value(in->array, in->dtype);
+    } else {
+        fft_load_real(in, data_re, data_im, 1);
+        fft_kernel_strided(data_re, data_im, 1, h, 1);
+        data_re[h] = fft_real_unpack(data_re, data_im, 1, h, twiddles);
+    }
+    mp_obj_t tuple[2];
+    tuple[0] = out_re;
+    tuple[1] = out_im;
+    return mp_obj_new_tuple(2, tuple);
+}
+#endif /* ULAB_FFT_HAS_RFFT */
+
+#if ULAB_FFT_HAS_IRFFT
+mp_obj_t fft_irfft(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im) {
+    if(!mp_obj_is_type(arg_re, &ulab_ndarray_type) || ((n_args == 2) && !mp_obj_is_type(arg_im, &ulab_ndarray_type))) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *re = MP_OBJ_TO_PTR(arg_re);
+    ndarray_obj_t *im = n_args == 2 ? MP_OBJ_TO_PTR(arg_im) : NULL;
+    #if ULAB_MAX_DIMS > 1
+    if((re->ndim != 1) || ((im != NULL) && (im->ndim != 1))) {
+        mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+    }
+    #endif
+    if((im != NULL) && (re->len != im->len)) {
+        mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+    }
+    // The half spectrum of a signal of length 2h has h + 1 elements
+    size_t h = re->len - 1;
+    if((re->len < 2) || ((h & (h-1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be power of 2"));
+    }
+    size_t len = 2 * h;
+    fft_twiddles_t *twiddles = fft_twiddles(len);
+
+    // The signal is computed in place of its interleaved transform
+    ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data = (mp_float_t *)out->array;
+    uint8_t *array = (uint8_t *)re->array;
+    mp_float_t (*func)(void *) = ndarray_get_float_function(re->dtype);
+    for(size_t k = 0; k < h; k++) {
+        data[2*k] = func(array);
+        array += re->strides[ULAB_MAX_DIMS - 1];
+    }
+    mp_float_t xh = func(array);
+    if(im != NULL) {
+        array = (uint8_t *)im->array;
+        func = ndarray_get_float_function(im->dtype);
+        for(size_t k = 0; k < h; k++) {
+            data[2*k+1] = func(array);
+            array += im->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+    fft_real_pack(data, data + 1, 2, h, xh, twiddles);
+    fft_kernel_strided(data, data + 1, 2, h, -1);
+    for(size_t i = 0; i < len; i++) {
+        data[i] /= h;
+    }
+    return MP_OBJ_FROM_PTR(out);
+}
+#endif /* ULAB_FFT_HAS_IRFFT */
 #endif  /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
@@ -23,6 +23,12 @@ mp_obj_t fft_fft_ifft_spectrogram(mp_obj_t , uint8_t );
 #else
 void fft_kernel(mp_float_t *, mp_float_t *, size_t , int );
 mp_obj_t fft_fft_ifft_spectrogram(size_t , mp_obj_t , mp_obj_t , uint8_t );
+#if ULAB_FFT_HAS_RFFT
+mp_obj_t fft_rfft(mp_obj_t );
+#endif
+#if ULAB_FFT_HAS_IRFFT
+mp_obj_t fft_irfft(size_t , mp_obj_t , mp_obj_t );
+#endif
 #endif /* ULAB_SUPPORTS_COMPLEX & ULAB_FFT_IS_NUMPY_COMPATIBLE */
 
 #endif /* _FFT_TOOLS_ */
@@ -32,7 +32,7 @@
 //| much more efficient than expressing the same operation as a Python loop."""
 //|
 
-static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)) {
+static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t), void (*kernel)(ndarray_obj_t *, mp_float_t *)) {
     // Return a single value, if o_in is not iterable
     if(mp_obj_is_float(o_in) || mp_obj_is_int(o_in)) {
         return mp_obj_new_float(f(mp_obj_get_float(o_in)));
@@ -41,12 +41,12 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
     if(mp_obj_is_type(o_in, &ulab_ndarray_type)) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
-        uint8_t *sarray = (uint8_t *)source->array;
         ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
 
         #if ULAB_VECTORISE_USES_FUN_POINTER
 
+            uint8_t *sarray = (uint8_t *)source->array;
             mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
 
             #if ULAB_MAX_DIMS > 3
@@ -87,17 +87,7 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
             } while(i < source->shape[ULAB_MAX_DIMS - 4]);
             #endif /* ULAB_MAX_DIMS > 3 */
         #else
-        if(source->dtype == NDARRAY_UINT8) {
-            ITERATE_VECTOR(uint8_t, array, source, sarray);
-        } else if(source->dtype == NDARRAY_INT8) {
-            ITERATE_VECTOR(int8_t, array, source, sarray);
-        } else if(source->dtype == NDARRAY_UINT16) {
-            ITERATE_VECTOR(uint16_t, array, source, sarray);
-        } else if(source->dtype == NDARRAY_INT16) {
-            ITERATE_VECTOR(int16_t, array, source, sarray);
-        } else {
-            ITERATE_VECTOR(mp_float_t, array, source, sarray);
-        }
+        kernel(source, array);
         #endif /* ULAB_VECTORISE_USES_FUN_POINTER */
     } else {
         ndarray = ndarray_from_mp_obj(o_in, 0);
@@ -368,8 +358,10 @@ static mp_float_t vector_degrees_(mp_float_t value) {
     return value * MICROPY_FLOAT_CONST(180.0) / MP_PI;
 }
 
+VECTOR_KERNEL(vector_degrees_kernel, vector_degrees_)
+
 static mp_obj_t vector_degrees(mp_obj_t x_obj) {
-    return vector_generic_vector(x_obj, vector_degrees_);
+    return vector_generic_vector(x_obj, vector_degrees_, VECTOR_KERNEL_POINTER(vector_degrees_kernel));
 }
 
 MP_DEFINE_CONST_FUN_OBJ_1(vector_degrees_obj, vector_degrees);
@@ -401,6 +393,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_erfc_obj, vector_erfc);
 //|    ...
 //|
 
+VECTOR_KERNEL(vector_exp_kernel, MICROPY_FLOAT_C_FUN(exp))
+
 static mp_obj_t vector_exp(mp_obj_t o_in) {
     #if ULAB_SUPPORTS_COMPLEX
     if(mp_obj_is_type(o_in, &mp_type_complex)) {
@@ -460,7 +454,7 @@ static mp_obj_t vector_exp(mp_obj_t o_in) {
         }
     }
     #endif
-    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(exp));
+    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(exp), VECTOR_KERNEL_POINTER(vector_exp_kernel));
 }
 
 MP_DEFINE_CONST_FUN_OBJ_1(vector_exp_obj, vector_exp);
@@ -546,8 +540,10 @@ static mp_float_t vector_radians_(mp_float_t value) {
     return value * MP_PI / MICROPY_FLOAT_CONST(180.0);
 }
 
+VECTOR_KERNEL(vector_radians_kernel, vector_radians_)
+
 static mp_obj_t vector_radians(mp_obj_t x_obj) {
-    return vector_generic_vector(x_obj, vector_radians_);
+    return vector_generic_vector(x_obj, vector_radians_, VECTOR_KERNEL_POINTER(vector_radians_kernel));
 }
 
 MP_DEFINE_CONST_FUN_OBJ_1(vector_radians_obj, vector_radians);
@@ -581,6 +577,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(vector_sinh_obj, vector_sinh);
 //|
 
 #if ULAB_SUPPORTS_COMPLEX
+VECTOR_KERNEL(vector_sqrt_kernel, MICROPY_FLOAT_C_FUN(sqrt))
+
 mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
@@ -713,7 +711,7 @@ mp_obj_t vector_sqrt(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
             }
         }
     }
-    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(sqrt));
+    return vector_generic_vector(o_in, MICROPY_FLOAT_C_FUN(sqrt), VECTOR_KERNEL_POINTER(vector_sqrt_kernel));
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(vector_sqrt_obj, 1, vector_sqrt);
 #else
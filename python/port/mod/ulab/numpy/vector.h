@@ -153,9 +153,68 @@ typedef struct _vectorized_function_obj_t {
 #endif /* ULAB_MAX_DIMS == 1 */
 #endif /* ULAB_HAS_FUNCTION_ITERATOR */
 
+#if ULAB_VECTORISE_USES_FUN_POINTER
+
+#define VECTOR_KERNEL(name, function)
+#define VECTOR_KERNEL_POINTER(name) NULL
+
+#else
+
+// Contiguous arrays are walked with a single, unrolled loop
+#define ITERATE_CONTIGUOUS_VECTOR(type, array, source, sarray) do {\
+    type *_sarray = (type *)(sarray);\
+    size_t _remaining = (source)->len;\
+    while(_remaining >= 4) {\
+        (array)[0] = f(_sarray[0]);\
+        (array)[1] = f(_sarray[1]);\
+        (array)[2] = f(_sarray[2]);\
+        (array)[3] = f(_sarray[3]);\
+        (array) += 4;\
+        _sarray += 4;\
+        _remaining -= 4;\
+    }\
+    while(_remaining > 0) {\
+        *(array)++ = f(*_sarray++);\
+        _remaining--;\
+    }\
+} while(0)
+
+#define ITERATE_VECTOR_KERNEL(type, array, source, sarray, contiguous) do {\
+    if(contiguous) {\
+        ITERATE_CONTIGUOUS_VECTOR(type, array, source, sarray);\
+    } else {\
+        ITERATE_VECTOR(type, array, source, sarray);\
+    }\
+} while(0)
+
+// Defines a kernel applying function to all the elements of a non-complex
+// ndarray. The dtype is dispatched once, and the constant function pointer
+// is resolved at compile time, so that function is called directly.
+#define VECTOR_KERNEL(name, function) \
+    static void name(ndarray_obj_t *source, mp_float_t *array) { \
+        mp_float_t (*const f)(mp_float_t) = (function); \
+        uint8_t *sarray = (uint8_t *)source->array; \
+        bool contiguous = ndarray_is_contiguous(source); \
+        if(source->dtype == NDARRAY_UINT8) { \
+            ITERATE_VECTOR_KERNEL(uint8_t, array, source, sarray, contiguous); \
+        } else if(source->dtype == NDARRAY_INT8) { \
+            ITERATE_VECTOR_KERNEL(int8_t, array, source, sarray, contiguous); \
+        } else if(source->dtype == NDARRAY_UINT16) { \
+            ITERATE_VECTOR_KERNEL(uint16_t, array, source, sarray, contiguous); \
+        } else if(source->dtype == NDARRAY_INT16) { \
+            ITERATE_VECTOR_KERNEL(int16_t, array, source, sarray, contiguous); \
+        } else { \
+            ITERATE_VECTOR_KERNEL(mp_float_t, array, source, sarray, contiguous); \
+        } \
+    }
+#define VECTOR_KERNEL_POINTER(name) (name)
+
+#endif /* ULAB_VECTORISE_USES_FUN_POINTER */
+
 #define MATH_FUN_1(py_name, c_name) \
+    VECTOR_KERNEL(vector_ ## py_name ## _kernel, MICROPY_FLOAT_C_FUN(c_name)) \
     static mp_obj_t vector_ ## py_name(mp_obj_t x_obj) { \
-        return vector_generic_vector(x_obj, MICROPY_FLOAT_C_FUN(c_name)); \
+        return vector_generic_vector(x_obj, MICROPY_FLOAT_C_FUN(c_name), VECTOR_KERNEL_POINTER(vector_ ## py_name ## _kernel)); \
 }
 
 #endif /* _VECTOR_ */
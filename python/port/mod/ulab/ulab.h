@@ -410,6 +410,21 @@
 #define ULAB_FFT_HAS_IFFT               (1)
 #endif
 
+#ifndef ULAB_FFT_HAS_RFFT
+#define ULAB_FFT_HAS_RFFT               (1)
+#endif
+
+#ifndef ULAB_FFT_HAS_IRFFT
+#define ULAB_FFT_HAS_IRFFT              (1)
+#endif
+
+// The sines used by the FFT are tabulated on the heap for transforms of
+// up to this length, and kept between calls. Longer transforms compute
+// them with a recurrence. A table takes a quarter of its length in floats.
+#ifndef ULAB_FFT_TWIDDLE_TABLE_MAX_LENGTH
+#define ULAB_FFT_TWIDDLE_TABLE_MAX_LENGTH (4096)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ALL
 #define ULAB_NUMPY_HAS_ALL              (1)
 #endif
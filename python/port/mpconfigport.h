@@ -151,6 +151,12 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+// The twiddle table of ulab's FFT is kept on the heap between calls
+#ifdef INCLUDE_ULAB
+#define MICROPY_PORT_ROOT_POINTERS \
+    void *ulab_fft_twiddles;
+#endif
+
 
 // Enable setjmp in debug mode. This is to avoid some optimizations done
 // specifically for x86_64 using inline assembly, which makes the debug binary
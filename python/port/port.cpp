@@ -213,6 +213,10 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+#ifdef INCLUDE_ULAB
+  // The table of the previous heap is gone
+  MP_STATE_PORT(ulab_fft_twiddles) = nullptr;
+#endif
 }
 
 void MicroPython::deinit() {
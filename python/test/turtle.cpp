@@ -1,4 +1,5 @@
 #include <quiz.h>
+#include <quiz/stopwatch.h>
 #include "execution_environment.h"
 
 // TODO: to be completed
@@ -36,3 +37,78 @@ QUIZ_CASE(python_turtle_circle) {
   //assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_turtle_fractals_benchmark) {
+  const char * scripts[] = {
+    // Koch snowflake
+"from turtle import *\n"
+"def koch(l,n):\n"
+"  if n == 0:\n"
+"    forward(l)\n"
+"    return\n"
+"  for a in (60,-120,60,0):\n"
+"    koch(l/3,n-1)\n"
+"    left(a)\n"
+"speed(0)\n"
+"penup()\n"
+"goto(-90,50)\n"
+"pendown()\n"
+"for i in range(3):\n"
+"  koch(180,4)\n"
+"  right(120)\n"
+"x,y=position()\n"
+"print(round(x),round(y))\n",
+    // Sierpinski triangle
+"from turtle import *\n"
+"def sierpinski(l,n):\n"
+"  if n == 0:\n"
+"    for i in range(3):\n"
+"      forward(l)\n"
+"      left(120)\n"
+"    return\n"
+"  sierpinski(l/2,n-1)\n"
+"  forward(l/2)\n"
+"  sierpinski(l/2,n-1)\n"
+"  backward(l/2)\n"
+"  left(60)\n"
+"  forward(l/2)\n"
+"  right(60)\n"
+"  sierpinski(l/2,n-1)\n"
+"  left(60)\n"
+"  backward(l/2)\n"
+"  right(60)\n"
+"speed(0)\n"
+"pensize(2)\n"
+"penup()\n"
+"goto(-100,-90)\n"
+"pendown()\n"
+"sierpinski(200,5)\n"
+"x,y=position()\n"
+"print(round(x),round(y))\n",
+    // Dragon curve
+"from turtle import *\n"
+"def dragon(l,n,a):\n"
+"  if n == 0:\n"
+"    forward(l)\n"
+"    return\n"
+"  dragon(l,n-1,90)\n"
+"  left(a)\n"
+"  dragon(l,n-1,-90)\n"
+"speed(0)\n"
+"pensize(3)\n"
+"dragon(6,10,90)\n"
+"x,y=position()\n"
+"print(round(x),round(y))\n"
+  };
+  // The fractals are closed or end at a known point
+  const char * positions[] = {
+    "-90 50\n",
+    "-100 -90\n",
+    "0 192\n"
+  };
+  for (int i = 0; i < 3; i++) {
+    uint64_t startTime = quiz_stopwatch_start();
+    assert_script_execution_succeeds(scripts[i], positions[i]);
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
@@ -1,4 +1,6 @@
 #include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <stdio.h>
 #include "execution_environment.h"
 
 QUIZ_CASE(python_ulab) {
@@ -50,3 +52,109 @@ QUIZ_CASE(python_ulab) {
   deinit_environment();
 }
 
+
+QUIZ_CASE(python_ulab_vector_functions) {
+  /* Integer dtypes, contiguous arrays whose length is not a multiple of the
+   * unrolling and strided views go through different loops. */
+  assert_script_execution_succeeds(
+"from ulab import numpy as np\n"
+"for t in (np.uint8, np.int8, np.uint16, np.int16, np.float):\n"
+"  a = np.array(range(11), dtype=t)\n"
+"  for b in (a, a[::3], a[1:6]):\n"
+"    s = np.sqrt(b)\n"
+"    e = np.exp(b)\n"
+"    for i in range(len(b)):\n"
+"      assert abs(s[i] - b[i] ** 0.5) < 1e-5\n"
+"      assert abs(e[i] - np.exp(float(b[i]))) < 1e-5 * e[i]\n"
+"m = np.array([[1, 4], [9, 16], [25, 36]], dtype=np.uint8)\n"
+"r = np.sqrt(m.transpose())\n"
+"assert r[0][2] == 5 and r[1][1] == 4\n");
+}
+
+QUIZ_CASE(python_ulab_vector_functions_benchmark) {
+  const char * scripts[] = {
+    // Contiguous float array
+"from ulab import numpy as np\n"
+"a = np.linspace(0, 1, 1000)\n"
+"for i in range(500):\n"
+"  b = np.sin(a)\n"
+"  b = np.exp(a)\n"
+"  b = np.sqrt(a)\n",
+    // Contiguous integer array
+"from ulab import numpy as np\n"
+"a = np.array(range(1000), dtype=np.uint16)\n"
+"for i in range(500):\n"
+"  b = np.sin(a)\n"
+"  b = np.exp(a)\n"
+"  b = np.sqrt(a)\n",
+    // Strided view
+"from ulab import numpy as np\n"
+"a = np.linspace(0, 1, 2000)[::2]\n"
+"for i in range(500):\n"
+"  b = np.sin(a)\n"
+"  b = np.exp(a)\n"
+"  b = np.sqrt(a)\n"
+  };
+  for (const char * script : scripts) {
+    uint64_t startTime = quiz_stopwatch_start();
+    assert_script_execution_succeeds(script);
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
+
+QUIZ_CASE(python_ulab_fft) {
+  /* Real signals are transformed with a transform of half their length, which
+   * is compared to the transform of the complex signal. */
+  assert_script_execution_succeeds(
+"from ulab import numpy as np\n"
+"from ulab import utils\n"
+"def close(a, b):\n"
+"  return np.max(abs(a - b)) < 1e-9 * (1 + np.max(abs(b)))\n"
+"for n in (1, 2, 4, 8, 64, 512):\n"
+"  x = np.array([(7 * k) % 11 - 3.5 for k in range(n)])\n"
+"  zero = np.zeros(n)\n"
+"  re, im = np.fft.fft(x, zero)\n"
+"  r, i = np.fft.fft(x)\n"
+"  assert close(r, re) and close(i, im)\n"
+"  r, i = np.fft.rfft(x)\n"
+"  assert len(r) == n // 2 + 1 and close(r, re[:n // 2 + 1]) and close(i, im[:n // 2 + 1])\n"
+"  assert close(utils.spectrogram(x), np.sqrt(re * re + im * im))\n"
+"  if n > 1:\n"
+"    assert close(np.fft.irfft(r, i), x)\n"
+"x = np.array(range(64), dtype=np.int16)[::2]\n"
+"r, i = np.fft.rfft(x)\n"
+"assert close(np.fft.irfft(r, i), x) and close(np.fft.irfft(r), np.fft.irfft(r, np.zeros(17)))\n");
+  TestExecutionEnvironment env = init_environnement();
+  assert_command_execution_succeeds(env, "from ulab import numpy as np");
+  assert_command_execution_fails(env, "np.fft.rfft(np.zeros(6))");
+  assert_command_execution_fails(env, "np.fft.irfft(np.zeros(1))");
+  assert_command_execution_fails(env, "np.fft.irfft(np.zeros(4))");
+  assert_command_execution_fails(env, "np.fft.irfft(np.zeros(5), np.zeros(4))");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_ulab_fft_benchmark) {
+  /* Each lap transforms real signals of length 64 to 4096, 262144 samples in
+   * total, with fft, rfft and spectrogram. The integer signal leaves room in
+   * the heap for the longest transforms, but not for the fft of length 4096. */
+  const char * transforms[] = {"np.fft.fft(x)", "np.fft.rfft(x)", "utils.spectrogram(x)"};
+  const int lengths[] = {64, 256, 1024, 4096};
+  for (const char * transform : transforms) {
+    for (int n : lengths) {
+      if (n == 4096 && transform == transforms[0]) {
+        continue;
+      }
+      char script[256];
+      snprintf(script, sizeof(script),
+"from ulab import numpy as np\n"
+"from ulab import utils\n"
+"x = np.array(range(%d), dtype=np.int16)\n"
+"for i in range(%d):\n"
+"  y = None\n"
+"  y = %s\n", n, 262144 / n, transform);
+      uint64_t startTime = quiz_stopwatch_start();
+      assert_script_execution_succeeds(script);
+      quiz_stopwatch_print_lap(startTime);
+    }
+  }
+}